@@ -0,0 +1,77 @@
+#pragma once
+
+#ifndef LZ_ASYNC_BUFFER_HPP
+#    define LZ_ASYNC_BUFFER_HPP
+
+#    include "detail/AsyncBufferIterator.hpp"
+#    include "detail/BasicIteratorView.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class AsyncBuffer final : public internal::BasicIteratorView<internal::AsyncBufferIterator<Iterator>> {
+    using State = internal::AsyncBufferState<Iterator>;
+
+public:
+    using iterator = internal::AsyncBufferIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    AsyncBuffer(Iterator begin, Iterator end, const std::size_t capacity) :
+        internal::BasicIteratorView<iterator>(iterator(std::make_shared<State>(std::move(begin), std::move(end), capacity)),
+                                              iterator()) {
+    }
+
+    AsyncBuffer() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns an input iterator that evaluates the sequence on a background thread, ahead of the thread that iterates over
+ * the result. This lets a slow source (i.e. reading or splitting a file, or an expensive chain of views) overlap with the work
+ * that is done with its elements.
+ * @details The background thread is started when the result is first iterated over. It copies the elements into a lock-free
+ * single producer, single consumer ring buffer of `capacity` elements, and only blocks if the buffer is full. The consuming
+ * thread only blocks if the buffer is empty. If the source throws, the exception is rethrown once all elements before it have
+ * been consumed. If the result is destroyed before its end is reached, the background thread stops after the element that it is
+ * evaluating, and is joined. The iterators share their state, so the sequence can only be iterated over once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param capacity The amount of elements that can be buffered. Must be greater than 0.
+ * @return An AsyncBuffer object from [begin, end) that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD AsyncBuffer<Iterator> asyncBufferRange(Iterator begin, Iterator end, const std::size_t capacity = 64) {
+    return { std::move(begin), std::move(end), capacity };
+}
+
+/**
+ * @brief Returns an input iterator that evaluates the sequence on a background thread, ahead of the thread that iterates over
+ * the result. See `lz::asyncBufferRange` for details.
+ * @param iterable The sequence to evaluate in the background.
+ * @param capacity The amount of elements that can be buffered. Must be greater than 0.
+ * @return An AsyncBuffer object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD AsyncBuffer<internal::IterTypeFromIterable<Iterable>>
+asyncBuffer(Iterable&& iterable, const std::size_t capacity = 64) {
+    return asyncBufferRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            capacity);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_ASYNC_BUFFER_HPP
@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef LZ_CACHE_HPP
+#    define LZ_CACHE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/CacheIterator.hpp"
+#    include "detail/CacheLastIterator.hpp"
+
+namespace lz {
+namespace internal {
+// Only the size of random access sequences is computed up front, finding the size of other sequences would evaluate them twice
+template<class Iterator>
+std::size_t cacheEndIndex(const Iterator& begin, const Iterator& end, std::true_type /* isRandomAccess */) {
+    return static_cast<std::size_t>(end - begin);
+}
+
+template<class Iterator>
+std::size_t cacheEndIndex(const Iterator&, const Iterator&, std::false_type /* isRandomAccess */) {
+    return CacheIterator<Iterator>::unknownEnd();
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class Iterator>
+class Cache final : public internal::BasicIteratorView<internal::CacheIterator<Iterator>> {
+public:
+    using iterator = internal::CacheIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Cache(const std::shared_ptr<internal::CacheStorage<Iterator>>& storage, const std::size_t endIndex) :
+        internal::BasicIteratorView<iterator>(iterator(storage, 0), iterator(storage, endIndex)) {
+    }
+
+    Cache() = default;
+};
+
+template<class Iterator>
+class CacheLast final : public internal::BasicIteratorView<internal::CacheLastIterator<Iterator>> {
+public:
+    using iterator = internal::CacheLastIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    CacheLast(Iterator begin, Iterator end) :
+        CacheLast(begin, std::move(end), std::make_shared<internal::LastValue<Iterator>>(begin)) {
+    }
+
+private:
+    CacheLast(Iterator begin, Iterator end, const std::shared_ptr<internal::LastValue<Iterator>>& last) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), last), iterator(std::move(end), last)) {
+    }
+
+public:
+    CacheLast() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Evaluates every element of a sequence at most once. The elements are stored the first time they are reached, after which
+ * every traversal or random access is served from the cache. Copies of the returned view share the same cache. Can also be
+ * used to traverse input iterators more than once. The returned view is random access if the sequence is, and forward
+ * otherwise, because the end of other sequences is only known once they are evaluated. The cache is not thread safe.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A Cache iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Cache<Iterator> cacheRange(Iterator begin, Iterator end) {
+    const std::size_t endIndex =
+        internal::cacheEndIndex(begin, end, std::integral_constant<bool, internal::IsRandomAccess<Iterator>::value>());
+    return { std::make_shared<internal::CacheStorage<Iterator>>(std::move(begin), std::move(end)), endIndex };
+}
+
+/**
+ * Evaluates every element of a sequence at most once. The elements are stored the first time they are reached, after which
+ * every traversal or random access is served from the cache. Copies of the returned view share the same cache. Can also be
+ * used to traverse input iterators more than once. The returned view is random access if the sequence is, and forward
+ * otherwise, because the end of other sequences is only known once they are evaluated. The cache is not thread safe.
+ * @param iterable The sequence to cache.
+ * @return A Cache iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Cache<I> cache(Iterable&& iterable) {
+    return cacheRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Stores the last dereferenced element of a sequence, so that dereferencing the same position again, i.e. in a `filter` after
+ * a `map`, does not evaluate it again. Only one element is stored, which is shared between the copies of the iterators, so
+ * the iterators are not thread safe. The elements are returned by value.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A CacheLast iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD CacheLast<Iterator> cacheLastRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Stores the last dereferenced element of a sequence, so that dereferencing the same position again, i.e. in a `filter` after
+ * a `map`, does not evaluate it again. Only one element is stored, which is shared between the copies of the iterators, so
+ * the iterators are not thread safe. The elements are returned by value.
+ * @param iterable The sequence to cache the current element of.
+ * @return A CacheLast iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD CacheLast<I> cacheLast(Iterable&& iterable) {
+    return cacheLastRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_CACHE_HPP
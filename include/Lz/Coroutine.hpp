@@ -0,0 +1,186 @@
+#pragma once
+
+#ifndef LZ_COROUTINE_HPP
+#    define LZ_COROUTINE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/GeneratorIterator.hpp"
+
+#    ifdef LZ_HAS_COROUTINES
+
+namespace lz {
+namespace internal {
+// Lambdas that are coroutines keep their captures in the closure, not in the coroutine frame, so the function has to live as
+// long as the coroutine
+template<class Function, class T>
+struct CoroutineState {
+    Function function;
+    Generator<T> generator;
+
+    template<class... Args>
+    explicit CoroutineState(Function f, Args&&... args) :
+        function(std::move(f)),
+        generator(function(std::forward<Args>(args)...)) {
+    }
+};
+
+template<class T, class Iterator>
+Generator<T> toGenerator(Iterator begin, Iterator end) {
+    for (; begin != end; ++begin) {
+        co_yield *begin;
+    }
+}
+
+// GCC < 14 falsely reports a mismatched operator delete for coroutines that use a templated operator new (GCC bug 109224)
+#        if defined(LZ_GCC_VERSION) && LZ_GCC_VERSION < 14
+#            pragma GCC diagnostic push
+#            pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#        endif
+template<class T, class Iterator>
+Generator<T> toGenerator(std::allocator_arg_t, std::pmr::memory_resource*, Iterator begin, Iterator end) {
+    for (; begin != end; ++begin) {
+        co_yield *begin;
+    }
+}
+#        if defined(LZ_GCC_VERSION) && LZ_GCC_VERSION < 14
+#            pragma GCC diagnostic pop
+#        endif
+
+template<class T>
+struct IsGenerator : std::false_type {};
+
+template<class T>
+struct IsGenerator<Generator<T>> : std::true_type {};
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @brief The return type of a coroutine that produces a sequence of `T` using `co_yield`, i.e.
+ * `lz::Generator<int> evens() { for (int i = 0;; i += 2) co_yield i; }`. The coroutine is started when the first element is
+ * requested, and runs until the next `co_yield` every time the iterator is incremented. The yielded values are not copied. If
+ * the coroutine throws, the exception is rethrown by the iterator. A Generator owns its coroutine and can only be iterated over
+ * once. Use `lz::fromCoroutine` to obtain a view that can be copied and chained.
+ * @details The coroutine frame is allocated by `std::pmr::get_default_resource()`, or by the memory resource that is passed to
+ * the coroutine if its first parameters are `(std::allocator_arg_t, std::pmr::memory_resource*)`. Passing i.e. a
+ * `std::pmr::monotonic_buffer_resource` avoids a heap allocation per coroutine.
+ */
+template<class T>
+class Generator {
+    std::coroutine_handle<internal::GeneratorPromise<T>> _handle{};
+
+public:
+    using promise_type = internal::GeneratorPromise<T>;
+    using iterator = internal::GeneratorIterator<T>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    explicit Generator(const std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {
+    }
+
+    Generator() = default;
+
+    Generator(Generator&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) {
+    }
+
+    Generator& operator=(Generator&& other) noexcept {
+        std::swap(_handle, other._handle);
+        return *this;
+    }
+
+    ~Generator() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+
+    LZ_NODISCARD iterator begin() const noexcept {
+        return iterator(_handle);
+    }
+
+    LZ_NODISCARD iterator end() const noexcept {
+        return {};
+    }
+};
+
+template<class T>
+class Coroutine final : public internal::BasicIteratorView<internal::GeneratorIterator<T>> {
+public:
+    using iterator = internal::GeneratorIterator<T>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    // The iterators share the ownership of `owner`, which owns the coroutine of `begin`
+    Coroutine(const iterator& begin, std::shared_ptr<void> owner) :
+        internal::BasicIteratorView<iterator>(iterator(begin, std::move(owner)), iterator()) {
+    }
+
+    Coroutine() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Calls a coroutine that returns a `lz::Generator<T>` with `args`, and returns an input view over the elements it yields.
+ * This makes it possible to write complex producers, such as parsers or tree walks, as coroutines, while using all other views
+ * of this library downstream, i.e. `lz::fromCoroutine(walk, root).filter(isLeaf).map(name)`.
+ * @details The function, and the coroutine, are owned by the view. Its iterators share the ownership, so the view can be copied
+ * and chained like any other view, but it can only be iterated over once. The coroutine is started when the first element is
+ * requested. To allocate the coroutine frame from a memory resource instead of the heap, let the coroutine take
+ * `(std::allocator_arg_t, std::pmr::memory_resource*, ...)`, and pass `std::allocator_arg, &resource, ...` as `args`.
+ * @param function A function (or lambda) that returns a `lz::Generator<T>`.
+ * @param args The arguments to call `function` with.
+ * @return An input view over the elements that the coroutine yields.
+ */
+template<class Function, class... Args,
+         class Gen = internal::Decay<decltype(std::declval<internal::Decay<Function>&>()(std::declval<Args>()...))>>
+LZ_NODISCARD Coroutine<typename Gen::value_type> fromCoroutine(Function&& function, Args&&... args) {
+    static_assert(internal::IsGenerator<Gen>::value, "function must return a lz::Generator");
+    using State = internal::CoroutineState<internal::Decay<Function>, typename Gen::value_type>;
+    auto state = std::make_shared<State>(std::forward<Function>(function), std::forward<Args>(args)...);
+    const auto begin = state->generator.begin();
+    return { begin, std::move(state) };
+}
+
+/**
+ * @brief Returns a `lz::Generator` that yields the elements of `iterable`, so that a view can be passed to code that expects a
+ * coroutine generator. The iterable is not copied, so it must outlive the generator, like with any other view.
+ * @param iterable The sequence to yield the elements of.
+ * @return A generator that yields the elements of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Generator<internal::ValueTypeIterable<Iterable>> toGenerator(Iterable&& iterable) {
+    return internal::toGenerator<internal::ValueTypeIterable<Iterable>>(internal::begin(std::forward<Iterable>(iterable)),
+                                                                        internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * @brief Returns a `lz::Generator` that yields the elements of `iterable`, of which the coroutine frame is allocated by
+ * `resource`. See `lz::toGenerator(iterable)` for details.
+ * @param resource The memory resource that allocates the coroutine frame. It must outlive the generator.
+ * @param iterable The sequence to yield the elements of.
+ * @return A generator that yields the elements of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Generator<internal::ValueTypeIterable<Iterable>>
+toGenerator(std::allocator_arg_t, std::pmr::memory_resource* resource, Iterable&& iterable) {
+    return internal::toGenerator<internal::ValueTypeIterable<Iterable>>(std::allocator_arg, resource,
+                                                                        internal::begin(std::forward<Iterable>(iterable)),
+                                                                        internal::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#    endif // LZ_HAS_COROUTINES
+
+#endif // LZ_COROUTINE_HPP
@@ -0,0 +1,323 @@
+#pragma once
+
+#ifndef LZ_EXPRESSION_HPP
+#    define LZ_EXPRESSION_HPP
+
+#    include "Zip.hpp"
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ExpressionIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @brief A lazy, element wise arithmetic or comparison expression over one or more views, created by using the operators
+ * `+, -, *, /, %, <, <=, >, >=` or unary `-` on views. See the operators in this file for the documentation.
+ */
+template<class Op, class... Iterators>
+class Expression final : public internal::BasicIteratorView<internal::ExpressionIterator<Op, Iterators...>> {
+    using Base = internal::BasicIteratorView<internal::ExpressionIterator<Op, Iterators...>>;
+
+public:
+    using iterator = internal::ExpressionIterator<Op, Iterators...>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using difference_type = typename iterator::difference_type;
+
+    // Random access expressions are evaluated with a single indexed loop: out[i] = op(a[i], b[i], ...). After inlining, the
+    // compiler sees a plain loop over all operands which it is able to vectorize
+    template<class OutputIterator, class I = iterator>
+    LZ_CONSTEXPR_CXX_20 internal::EnableIf<internal::IsRandomAccess<I>::value> evaluateTo(OutputIterator out) const {
+        const iterator first = this->_begin;
+        const difference_type size = this->_end - first;
+        for (difference_type i = 0; i < size; ++i, ++out) {
+            *out = first[i];
+        }
+    }
+
+    template<class OutputIterator, class I = iterator>
+    LZ_CONSTEXPR_CXX_20 internal::EnableIf<!internal::IsRandomAccess<I>::value> evaluateTo(OutputIterator out) const {
+        std::copy(this->_begin, this->_end, out);
+    }
+
+    template<class Allocator, class I = iterator>
+    LZ_CONSTEXPR_CXX_20
+        internal::EnableIf<internal::IsRandomAccess<I>::value && std::is_default_constructible<value_type>::value, void>
+        evaluateTo(std::vector<value_type, Allocator>& vec) const {
+        vec.resize(static_cast<std::size_t>(this->_end - this->_begin));
+        evaluateTo(vec.begin());
+    }
+
+    template<class Allocator, class I = iterator>
+    LZ_CONSTEXPR_CXX_20
+        internal::EnableIf<!internal::IsRandomAccess<I>::value || !std::is_default_constructible<value_type>::value, void>
+        evaluateTo(std::vector<value_type, Allocator>& vec) const {
+        vec.reserve(static_cast<std::size_t>(internal::sizeHint(this->_begin, this->_end)));
+        std::copy(this->_begin, this->_end, std::back_inserter(vec));
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 Expression(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, Op op) :
+        Base(iterator(std::move(begin), op), iterator(std::move(end), op)) {
+    }
+
+    constexpr Expression() = default;
+
+    /**
+     * Fills destination output iterator `outputIterator` with the evaluated expression. If all operands are random access,
+     * this is done using a single indexed loop.
+     * @param outputIterator The output to fill into.
+     */
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator) const {
+        evaluateTo(std::move(outputIterator));
+    }
+
+#    ifdef LZ_HAS_EXECUTION
+    /**
+     * Fills destination output iterator `outputIterator` with the evaluated expression. If all operands are random access
+     * and `execution` is sequenced, this is done using a single indexed loop.
+     * @param outputIterator The output to fill into.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     */
+    template<class OutputIterator, class Execution>
+    LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator, Execution execution) const {
+        if constexpr (internal::IsSequencedPolicyV<Execution>) {
+            static_cast<void>(execution);
+            evaluateTo(std::move(outputIterator));
+        }
+        else {
+            Base::copyTo(std::move(outputIterator), execution);
+        }
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type>` of the evaluated expression. If all operands are random access and
+     * `execution` is sequenced, this is done using a single indexed loop into the vector's buffer.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return A `std::vector<value_type>` with the evaluated expression.
+     */
+    template<class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::vector<value_type> toVector(Execution execution = std::execution::seq) const {
+        return toVector(std::allocator<value_type>(), execution);
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type, Allocator>` of the evaluated expression. If all operands are random
+     * access and `execution` is sequenced, this is done using a single indexed loop into the vector's buffer.
+     * @param alloc The allocator.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     * @return A new `std::vector<value_type, Allocator>`.
+     */
+    template<class Allocator, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::vector<value_type, Allocator>
+    toVector(const Allocator& alloc, Execution execution) const {
+        if constexpr (internal::IsSequencedPolicyV<Execution>) {
+            std::vector<value_type, Allocator> vec(alloc);
+            evaluateTo(vec);
+            return vec;
+        }
+        else {
+            return Base::toVector(alloc, execution);
+        }
+    }
+#    else
+    /**
+     * @brief Creates a new `std::vector<value_type>` of the evaluated expression. If all operands are random access, this
+     * is done using a single indexed loop into the vector's buffer.
+     * @return A `std::vector<value_type>` with the evaluated expression.
+     */
+    std::vector<value_type> toVector() const {
+        return toVector(std::allocator<value_type>());
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type, Allocator>` of the evaluated expression. If all operands are random
+     * access, this is done using a single indexed loop into the vector's buffer.
+     * @param alloc The allocator.
+     * @return A new `std::vector<value_type, Allocator>`.
+     */
+    template<class Allocator>
+    std::vector<value_type, Allocator> toVector(const Allocator& alloc) const {
+        std::vector<value_type, Allocator> vec(alloc);
+        evaluateTo(vec);
+        return vec;
+    }
+#    endif // LZ_HAS_EXECUTION
+};
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+namespace internal {
+template<class It>
+std::true_type isViewImpl(const BasicIteratorView<It>*);
+
+std::false_type isViewImpl(...);
+
+template<class T>
+struct IsView : decltype(isViewImpl(std::declval<Decay<T>*>())) {};
+
+template<class T, bool = IsView<T>::value>
+struct ExpressionOperand {
+    using iterator = IterTypeFromIterable<const T&>;
+
+    static LZ_CONSTEXPR_CXX_20 iterator begin(const T& view) {
+        return view.begin();
+    }
+
+    static LZ_CONSTEXPR_CXX_20 iterator end(const T& view) {
+        return view.end();
+    }
+};
+
+template<class T>
+struct ExpressionOperand<T, false> {
+    using iterator = ScalarIterator<T>;
+
+    static constexpr iterator begin(const T& value) {
+        return iterator(value);
+    }
+
+    static constexpr iterator end(const T& value) {
+        return iterator(value);
+    }
+};
+
+// At least one operand must be a view, the others may be arithmetic scalars
+template<class L, class R>
+struct IsExpression : std::integral_constant<bool, (IsView<L>::value && (IsView<R>::value || std::is_arithmetic<R>::value)) ||
+                                                       (std::is_arithmetic<L>::value && IsView<R>::value)> {};
+
+template<class Op, class... Operands>
+using ExpressionFor = Expression<Op, typename ExpressionOperand<Operands>::iterator...>;
+
+template<class Op, class... Operands>
+LZ_CONSTEXPR_CXX_20 ExpressionFor<Op, Operands...> makeExpression(Op op, const Operands&... operands) {
+    using Iterators = std::tuple<typename ExpressionOperand<Operands>::iterator...>;
+    Iterators begin(ExpressionOperand<Operands>::begin(operands)...);
+    Iterators end(ExpressionOperand<Operands>::end(operands)...);
+    using CommonIterTag = typename std::common_type<IterCat<typename ExpressionOperand<Operands>::iterator>...>::type;
+    if LZ_CONSTEXPR_IF (IsRandomAccessTag<CommonIterTag>::value) {
+        end = createFakeEnd(begin, std::move(end), MakeIndexSequence<sizeof...(Operands)>());
+    }
+    return { std::move(begin), std::move(end), std::move(op) };
+}
+
+#    define LZ_EXPRESSION_BINARY_OP(NAME, OP)                                                                                     \
+        struct NAME {                                                                                                            \
+            template<class A, class B>                                                                                           \
+            constexpr auto operator()(const A& a, const B& b) const -> decltype(a OP b) {                                        \
+                return a OP b;                                                                                                   \
+            }                                                                                                                    \
+        }
+
+LZ_EXPRESSION_BINARY_OP(PlusOp, +);
+LZ_EXPRESSION_BINARY_OP(MinusOp, -);
+LZ_EXPRESSION_BINARY_OP(MultipliesOp, *);
+LZ_EXPRESSION_BINARY_OP(DividesOp, /);
+LZ_EXPRESSION_BINARY_OP(ModulusOp, %);
+LZ_EXPRESSION_BINARY_OP(LessOp, <);
+LZ_EXPRESSION_BINARY_OP(LessEqualOp, <=);
+LZ_EXPRESSION_BINARY_OP(GreaterOp, >);
+LZ_EXPRESSION_BINARY_OP(GreaterEqualOp, >=);
+
+#    undef LZ_EXPRESSION_BINARY_OP
+
+struct NegateOp {
+    template<class A>
+    constexpr auto operator()(const A& a) const -> decltype(-a) {
+        return -a;
+    }
+};
+
+// The operators live in lz::internal, so that they are found through ADL for every view, as all views derive from
+// internal::BasicIteratorView. `==` and `!=` are deliberately not overloaded, because they would be confused with
+// comparing two sequences (use `lz::equal` for that)
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @brief Creates a lazy expression that adds the elements of `lhs` and `rhs` element wise. Either side may be a view or an
+ * arithmetic scalar, but at least one of them must be a view. Expressions can be nested, e.g.
+ * `lz::view(x) + lz::view(y) * 3`. If all views are random access, `toVector` and `copyTo` evaluate the complete expression
+ * using a single (vectorizable) loop. The expression stops at its shortest view.
+ * @param lhs The left hand side view or scalar.
+ * @param rhs The right hand side view or scalar.
+ * @return An Expression view that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<PlusOp, L, R>>
+operator+(const L& lhs, const R& rhs) {
+    return makeExpression(PlusOp{}, lhs, rhs);
+}
+
+//! Element wise subtraction. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<MinusOp, L, R>>
+operator-(const L& lhs, const R& rhs) {
+    return makeExpression(MinusOp{}, lhs, rhs);
+}
+
+//! Element wise multiplication. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<MultipliesOp, L, R>>
+operator*(const L& lhs, const R& rhs) {
+    return makeExpression(MultipliesOp{}, lhs, rhs);
+}
+
+//! Element wise division. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<DividesOp, L, R>>
+operator/(const L& lhs, const R& rhs) {
+    return makeExpression(DividesOp{}, lhs, rhs);
+}
+
+//! Element wise modulus. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<ModulusOp, L, R>>
+operator%(const L& lhs, const R& rhs) {
+    return makeExpression(ModulusOp{}, lhs, rhs);
+}
+
+//! Element wise `<`, yielding a `bool` per element. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<LessOp, L, R>>
+operator<(const L& lhs, const R& rhs) {
+    return makeExpression(LessOp{}, lhs, rhs);
+}
+
+//! Element wise `<=`, yielding a `bool` per element. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<LessEqualOp, L, R>>
+operator<=(const L& lhs, const R& rhs) {
+    return makeExpression(LessEqualOp{}, lhs, rhs);
+}
+
+//! Element wise `>`, yielding a `bool` per element. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<GreaterOp, L, R>>
+operator>(const L& lhs, const R& rhs) {
+    return makeExpression(GreaterOp{}, lhs, rhs);
+}
+
+//! Element wise `>=`, yielding a `bool` per element. See `operator+` for documentation.
+template<class L, class R>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsExpression<L, R>::value, ExpressionFor<GreaterEqualOp, L, R>>
+operator>=(const L& lhs, const R& rhs) {
+    return makeExpression(GreaterEqualOp{}, lhs, rhs);
+}
+
+//! Element wise negation. See `operator+` for documentation.
+template<class T>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsView<T>::value, ExpressionFor<NegateOp, T>> operator-(const T& view) {
+    return makeExpression(NegateOp{}, view);
+}
+
+LZ_MODULE_EXPORT_SCOPE_END
+} // namespace internal
+
+} // namespace lz
+
+#endif // LZ_EXPRESSION_HPP
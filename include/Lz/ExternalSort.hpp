@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef LZ_EXTERNAL_SORT_HPP
+#    define LZ_EXTERNAL_SORT_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ExternalSortIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class T, class Compare>
+class ExternalSort final : public internal::BasicIteratorView<internal::ExternalSortIterator<T, Compare>> {
+public:
+    using iterator = internal::ExternalSortIterator<T, Compare>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    template<class Iterator>
+    ExternalSort(Iterator begin, Iterator end, Compare compare, const std::size_t memoryBudget, const std::string& directory) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<internal::ExternalMerge<T, Compare>>(std::move(begin), std::move(end), std::move(compare),
+                                                                           memoryBudget, directory)),
+            iterator()) {
+    }
+
+    ExternalSort() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Sorts a sequence that does not fit in memory, using an external merge sort.
+ * @details The sequence is read once and split into runs of (approximately) `memoryBudget` bytes. Every run is sorted and, except
+ * for the last one, written to a temporary file. Every 16 runs of the same size are merged into one larger run while reading,
+ * so that at most 16 runs are merged at once and the amount of open files stays small. The returned view merges the remaining
+ * runs lazily (k-way merge), reading the files sequentially. Files are created exclusively, so existing files in `directory` are
+ * never overwritten. Only trivially copyable types (stored in their binary representation) and `std::basic_string` are supported.
+ * The sort is stable. The view is single pass: all its iterators share the same position, and the temporary files are removed
+ * once the view and its iterators are destroyed. If a run file cannot be written or read back, `std::system_error` is thrown.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param memoryBudget The (approximate) amount of bytes of elements that are kept in memory at once while creating the runs.
+ * @param directory The directory to write the runs to. If empty, `std::tmpfile` is used.
+ * @return An ExternalSort object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD ExternalSort<internal::ValueType<Iterator>, Compare>
+externalSortRange(Iterator begin, Iterator end, Compare compare = {}, const std::size_t memoryBudget = std::size_t{ 64 } << 20,
+                  const std::string& directory = {}) {
+    return { std::move(begin), std::move(end), std::move(compare), memoryBudget, directory };
+}
+
+/**
+ * @brief Sorts a sequence that does not fit in memory, using an external merge sort.
+ * @details The sequence is read once and split into runs of (approximately) `memoryBudget` bytes. Every run is sorted and, except
+ * for the last one, written to a temporary file. Every 16 runs of the same size are merged into one larger run while reading,
+ * so that at most 16 runs are merged at once and the amount of open files stays small. The returned view merges the remaining
+ * runs lazily (k-way merge), reading the files sequentially. Files are created exclusively, so existing files in `directory` are
+ * never overwritten. Only trivially copyable types (stored in their binary representation) and `std::basic_string` are supported.
+ * The sort is stable. The view is single pass: all its iterators share the same position, and the temporary files are removed
+ * once the view and its iterators are destroyed. If a run file cannot be written or read back, `std::system_error` is thrown.
+ * @param iterable The sequence to sort.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param memoryBudget The (approximate) amount of bytes of elements that are kept in memory at once while creating the runs.
+ * @param directory The directory to write the runs to. If empty, `std::tmpfile` is used.
+ * @return An ExternalSort object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD ExternalSort<internal::ValueTypeIterable<Iterable>, Compare>
+externalSort(Iterable&& iterable, Compare compare = {}, const std::size_t memoryBudget = std::size_t{ 64 } << 20,
+             const std::string& directory = {}) {
+    return externalSortRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                             std::move(compare), memoryBudget, directory);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_EXTERNAL_SORT_HPP
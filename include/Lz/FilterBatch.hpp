@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef LZ_FILTER_BATCH_HPP
+#    define LZ_FILTER_BATCH_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/FilterBatchIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator, class BatchPredicate>
+class FilterBatch final : public internal::BasicIteratorView<internal::FilterBatchIterator<Iterator, BatchPredicate>> {
+public:
+    using iterator = internal::FilterBatchIterator<Iterator, BatchPredicate>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 FilterBatch(Iterator begin, Iterator end, BatchPredicate predicate) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, predicate), iterator(end, end, predicate)) {
+    }
+
+    constexpr FilterBatch() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a forward filter iterator whose predicate is evaluated per block of (at most) 64 elements instead of per
+ * element.
+ * @details The predicate is called as `predicate(const value_type* block, std::size_t count)` and must return an
+ * `std::uint64_t` where bit `i` is set if `block[i]` must be kept. This allows the predicate to compare a complete block at
+ * once (for instance using SIMD instructions) without any branches. The selected elements are then walked by their set bits.
+ * If the sequence is contiguous (e.g. `std::vector` or a pointer), `block` points directly into the sequence. Otherwise, the
+ * block is copied into a buffer of 64 elements first, from which elements that the sequence returns by value (i.e. `lz::map`)
+ * are also returned, so that every element is evaluated once. Copies of an iterator share this buffer, until one of them moves
+ * to the next block. The value type must then be default constructible.
+ * Bits beyond `count` are ignored. I.e.
+ * `lz::filterBatch(vec, [](const int* b, std::size_t n) { std::uint64_t m = 0; for (std::size_t i = 0; i < n; ++i) m |=
+ * std::uint64_t(b[i] > 0) << i; return m; })` yields all positive elements of `vec`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param predicate A function that takes a pointer to a block and its size and returns a bitmask of the elements to keep.
+ * @return A FilterBatch object from [begin, end) that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class BatchPredicate>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FilterBatch<Iterator, BatchPredicate>
+filterBatchRange(Iterator begin, Iterator end, BatchPredicate predicate) {
+    static_assert(internal::IsForward<Iterator>::value, "Iterator must be at least a forward iterator");
+    static_assert(std::is_convertible<decltype(predicate(std::declval<const internal::ValueType<Iterator>*>(), std::size_t{})),
+                                      std::uint64_t>::value,
+                  "predicate must return a bitmask that is convertible to std::uint64_t");
+    return { std::move(begin), std::move(end), std::move(predicate) };
+}
+
+/**
+ * @brief Returns a forward filter iterator whose predicate is evaluated per block of (at most) 64 elements instead of per
+ * element.
+ * @details The predicate is called as `predicate(const value_type* block, std::size_t count)` and must return an
+ * `std::uint64_t` where bit `i` is set if `block[i]` must be kept. This allows the predicate to compare a complete block at
+ * once (for instance using SIMD instructions) without any branches. The selected elements are then walked by their set bits.
+ * If the sequence is contiguous (e.g. `std::vector` or a pointer), `block` points directly into the sequence. Otherwise, the
+ * block is copied into a buffer of 64 elements first, from which elements that the sequence returns by value (i.e. `lz::map`)
+ * are also returned, so that every element is evaluated once. Copies of an iterator share this buffer, until one of them moves
+ * to the next block. The value type must then be default constructible.
+ * Bits beyond `count` are ignored.
+ * @param iterable The sequence to filter.
+ * @param predicate A function that takes a pointer to a block and its size and returns a bitmask of the elements to keep.
+ * @return A FilterBatch object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class BatchPredicate>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FilterBatch<internal::IterTypeFromIterable<Iterable>, BatchPredicate>
+filterBatch(Iterable&& iterable, BatchPredicate predicate) {
+    return filterBatchRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            std::move(predicate));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_FILTER_BATCH_HPP
@@ -10,10 +10,14 @@
 #    include "StringSplitter.hpp"
 #    include "Take.hpp"
 #    include "Zip.hpp"
+#    include "detail/FilterMapOptIterator.hpp"
+#    include "detail/RadixSort.hpp"
+#    include "detail/Split.hpp"
 
 #    include <algorithm>
 #    include <cctype>
 #    include <numeric>
+#    include <tuple>
 
 #    ifdef LZ_HAS_CXX_17
 #        define LZ_INLINE_VAR inline
@@ -43,6 +47,50 @@ struct GetFn {
         return std::get<I>(std::forward<T>(gettable));
     }
 };
+
+// Reserves room for `size` more elements, if the container supports it
+template<class Container>
+EnableIf<HasReserve<Container>::value> reserveMore(Container& container, const std::size_t size) {
+    if (size != 0) {
+        container.reserve(container.size() + size);
+    }
+}
+
+template<class Container>
+EnableIf<!HasReserve<Container>::value> reserveMore(Container&, std::size_t) {
+}
+
+template<class Iterator, class TrueContainer, class FalseContainer, class UnaryPredicate>
+void partitionTo(Iterator begin, const Iterator& end, TrueContainer& outTrue, FalseContainer& outFalse,
+                 UnaryPredicate predicate) {
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        if (predicate(value)) {
+            outTrue.insert(outTrue.end(), std::forward<decltype(value)>(value));
+        }
+        else {
+            outFalse.insert(outFalse.end(), std::forward<decltype(value)>(value));
+        }
+    }
+}
+
+template<class Iterator, class Outputs, std::size_t... I>
+void unzipTo(Iterator begin, const Iterator& end, Outputs& outputs, IndexSequence<I...>) {
+    const std::size_t size = knownSize(begin, end);
+    const int reserve[] = { 0, (reserveMore(std::get<I>(outputs), size), 0)... };
+    static_cast<void>(reserve);
+
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        // Every output takes a different member of `value`, so every member is moved at most once
+        const int expand[] = {
+            0, (static_cast<void>(std::get<I>(outputs).insert(std::get<I>(outputs).end(),
+                                                              std::get<I>(std::forward<decltype(value)>(value)))),
+                0)...
+        };
+        static_cast<void>(expand);
+    }
+}
 } // namespace internal
 
 LZ_MODULE_EXPORT_SCOPE_BEGIN
@@ -355,6 +403,73 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::IterTypeFromIterable<Iterable>, i
     return lz::keys(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
 }
 
+/**
+ * Calls `function` once for every element and returns the values of the results that contain a value. `function` must return
+ * an optional-like type, i.e. `std::optional` or a pointer: it must be convertible to `bool` and support `operator*`. Unlike
+ * `filterMap`, a value that is both checked and transformed is computed only once, and is stored until the iterator is
+ * incremented.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function The function that returns an optional-like value for every element.
+ * @return A view object that can be iterated over. Its `value_type` is the type contained by the result of `function`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<internal::FilterMapOptIterator<Iterator, Function>>
+filterMapOpt(Iterator begin, Iterator end, Function function) {
+    using FilterMapOptIterator = internal::FilterMapOptIterator<Iterator, Function>;
+    return { FilterMapOptIterator(begin, end, function), FilterMapOptIterator(end, end, function) };
+}
+
+/**
+ * Calls `function` once for every element and returns the values of the results that contain a value. `function` must return
+ * an optional-like type, i.e. `std::optional` or a pointer: it must be convertible to `bool` and support `operator*`. Unlike
+ * `filterMap`, a value that is both checked and transformed is computed only once, and is stored until the iterator is
+ * incremented.
+ * @param iterable The sequence to filter and map.
+ * @param function The function that returns an optional-like value for every element.
+ * @return A view object that can be iterated over. Its `value_type` is the type contained by the result of `function`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+internal::BasicIteratorView<internal::FilterMapOptIterator<internal::IterTypeFromIterable<Iterable>, Function>>
+filterMapOpt(Iterable&& iterable, Function function) {
+    return lz::filterMapOpt(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            std::move(function));
+}
+
+/**
+ * Splits a sequence into the elements for which `predicate` returns true and the elements for which it returns false, in a
+ * single pass, i.e. `view.partitionTo(valid, invalid, isValid)`. Unlike `filter(p)` followed by `filter(!p)`, every element
+ * (and every function applied to it upstream) is evaluated once. The elements are appended to the end of the containers, in
+ * order. The sizes of the outputs are only known afterwards, so, unlike `lz::unzipTo`, they are not reserved up front; see
+ * `lz::parallelPartitionTo` for a version that reserves exactly.
+ * @param iterable The sequence to partition.
+ * @param outTrue The container to append the elements to for which `predicate` returns true.
+ * @param outFalse The container to append the elements to for which `predicate` returns false.
+ * @param predicate The predicate that must return a bool.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class TrueContainer, class FalseContainer, class UnaryPredicate>
+void partitionTo(Iterable&& iterable, TrueContainer& outTrue, FalseContainer& outFalse, UnaryPredicate predicate) {
+    internal::partitionTo(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          outTrue, outFalse, std::move(predicate));
+}
+
+/**
+ * Appends every member of every element to its own container in a single pass, i.e.
+ * `lz::unzipTo(lz::zip(names, ages), outNames, outAges)`. The `value_type` of the sequence must support `std::get<I>` (i.e.
+ * `std::pair` or `std::tuple`), where member `I` is appended to the `I`th container. Unlike `lz::keys` followed by `lz::values`,
+ * every element is evaluated once. If the size of the sequence is known without evaluating it (i.e. if it can be split, see
+ * `lz::splitInto`), every container that has a `reserve` method reserves exactly enough room for the new elements.
+ * @param iterable The sequence of tuple-like elements to unzip.
+ * @param outputs The containers to append the members to. There may be less containers than there are members.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class... Containers>
+void unzipTo(Iterable&& iterable, Containers&... outputs) {
+    std::tuple<Containers&...> tuple(outputs...);
+    internal::unzipTo(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), tuple,
+                      internal::MakeIndexSequence<sizeof...(Containers)>());
+}
+
 #    ifdef LZ_HAS_EXECUTION
 /**
  * Gets the mean of a sequence.
@@ -757,7 +872,7 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::size_t
 indexOf(Iterator begin, Iterator end, const T& val, Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        const Iterator pos = std::find(begin, end, val);
+        const Iterator pos = internal::findValue(begin, end, val);
         return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
     }
     else {
@@ -830,7 +945,7 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool
 contains(Iterator begin, Iterator end, const T& value, Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        return std::find(begin, end, value) != end;
+        return internal::findValue(begin, end, value) != end;
     }
     else {
         return std::find(execution, begin, end, value) != end;
@@ -884,44 +999,228 @@ containsIf(const Iterable& iterable, BinaryPredicate predicate, Execution execut
     return lz::containsIf(std::begin(iterable), std::end(iterable), std::move(predicate), execution);
 }
 
+/**
+ * Checks whether [beginA, endA) starts with [beginB, endB). If both sequences are contiguous, have the same integral value type
+ * and `compare` is `std::equal_to`, `memcmp` is used.
+ * @param beginA The beginning of the sequence to check.
+ * @param endA The ending of the sequence to check.
+ * @param beginB The beginning of the prefix.
+ * @param endB The ending of the prefix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return True if [beginA, endA) starts with [beginB, endB), false otherwise.
+ */
 template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to<>,
          class Execution = std::execution::sequenced_policy>
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {},
                 Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, IteratorA>()) {
-        return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+        static_cast<void>(execution);
+        return internal::rangeStartsWith(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
+                                         std::move(compare));
     }
     else {
         static_assert(internal::IsForwardOrStrongerV<IteratorB>,
                       "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-        return std::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
-                           std::move(compare)) != endA;
+        return std::mismatch(execution, std::move(beginA), std::move(endA), beginB, endB, std::move(compare)).second == endB;
     }
 }
 
+/**
+ * Checks whether `a` starts with `b`. If both sequences are contiguous, have the same integral value type and `compare` is
+ * `std::equal_to`, `memcmp` is used.
+ * @param a The sequence to check.
+ * @param b The prefix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return True if `a` starts with `b`, false otherwise.
+ */
 template<class IterableA, class IterableB, class BinaryPredicate = std::equal_to<>,
          class Execution = std::execution::sequenced_policy>
 bool startsWith(const IterableA& a, const IterableB& b, BinaryPredicate compare = {}, Execution execution = std::execution::seq) {
     return startsWith(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(compare), execution);
 }
 
+/**
+ * Checks whether [beginA, endA) ends with [beginB, endB). If both sequences are contiguous, have the same integral value type
+ * and `compare` is `std::equal_to`, `memcmp` is used.
+ * @param beginA The beginning of the sequence to check.
+ * @param endA The ending of the sequence to check.
+ * @param beginB The beginning of the suffix.
+ * @param endB The ending of the suffix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return True if [beginA, endA) ends with [beginB, endB), false otherwise.
+ */
 template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to<>,
          class Execution = std::execution::sequenced_policy>
 bool endsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {},
               Execution execution = std::execution::seq) {
-    std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
-    std::reverse_iterator<IteratorA> revBegA(std::move(endA));
-    std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
-    std::reverse_iterator<IteratorB> revBegB(std::move(endB));
-    return lz::startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB), std::move(compare),
-                          execution);
+    if constexpr (internal::checkForwardAndPolicies<Execution, IteratorA>()) {
+        static_cast<void>(execution);
+        return internal::rangeEndsWith(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
+                                       std::move(compare));
+    }
+    else {
+        std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
+        std::reverse_iterator<IteratorA> revBegA(std::move(endA));
+        std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
+        std::reverse_iterator<IteratorB> revBegB(std::move(endB));
+        return lz::startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB),
+                              std::move(compare), execution);
+    }
 }
 
+/**
+ * Checks whether `a` ends with `b`. If both sequences are contiguous, have the same integral value type and `compare` is
+ * `std::equal_to`, `memcmp` is used.
+ * @param a The sequence to check.
+ * @param b The suffix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return True if `a` ends with `b`, false otherwise.
+ */
 template<class IterableA, class IterableB, class BinaryPredicate = std::equal_to<>,
          class Execution = std::execution::sequenced_policy>
 bool endsWith(const IterableA& a, const IterableB& b, BinaryPredicate compare = {}, Execution execution = std::execution::seq) {
     return endsWith(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(compare), execution);
 }
+
+/**
+ * Sorts [begin, end) ascending. If the value type is an integral or floating point type, a radix sort is used instead of
+ * `std::sort`. If a parallel execution policy is passed, the histograms and the scatter of the radix sort are computed per
+ * partition in parallel.
+ * @param begin The beginning of the sequence to sort.
+ * @param end The ending of the sequence to sort.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Execution = std::execution::sequenced_policy>
+void sortInPlace(Iterator begin, Iterator end, Execution execution = std::execution::seq) {
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        internal::sortInPlace(std::move(begin), std::move(end), internal::SequentialRunner());
+    }
+    else {
+        internal::sortInPlace(std::move(begin), std::move(end), internal::ParallelRunner<Execution>(execution));
+    }
+}
+
+/**
+ * Sorts `iterable` ascending. If the value type is an integral or floating point type, a radix sort is used instead of
+ * `std::sort`. If a parallel execution policy is passed, the histograms and the scatter of the radix sort are computed per
+ * partition in parallel.
+ * @param iterable The sequence to sort.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Execution = std::execution::sequenced_policy>
+void sortInPlace(Iterable& iterable, Execution execution = std::execution::seq) {
+    lz::sortInPlace(std::begin(iterable), std::end(iterable), execution);
+}
+
+/**
+ * Copies [begin, end) to a vector and sorts it ascending. If the value type is an integral or floating point type, a radix sort
+ * is used instead of `std::sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::EnableIf<std::is_execution_policy<Execution>::value, std::vector<internal::ValueType<Iterator>>>
+sortedVector(Iterator begin, Iterator end, Execution execution = std::execution::seq) {
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        return internal::sortedVector(std::move(begin), std::move(end), internal::SequentialRunner());
+    }
+    else {
+        return internal::sortedVector(std::move(begin), std::move(end), internal::ParallelRunner<Execution>(execution));
+    }
+}
+
+/**
+ * Copies `iterable` to a vector and sorts it ascending. If the value type is an integral or floating point type, a radix sort
+ * is used instead of `std::sort`.
+ * @param iterable The sequence.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::EnableIf<std::is_execution_policy<Execution>::value, std::vector<internal::ValueTypeIterable<Iterable>>>
+sortedVector(const Iterable& iterable, Execution execution = std::execution::seq) {
+    return lz::sortedVector(std::begin(iterable), std::end(iterable), execution);
+}
+
+/**
+ * Copies [begin, end) to a vector and sorts it stably by the key returned by `keySelector`. Every key is computed only once.
+ * If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::EnableIf<!std::is_execution_policy<KeySelector>::value, std::vector<internal::ValueType<Iterator>>>
+sortedVector(Iterator begin, Iterator end, KeySelector keySelector, Execution execution = std::execution::seq) {
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        return internal::sortedVector(std::move(begin), std::move(end), std::move(keySelector), internal::SequentialRunner());
+    }
+    else {
+        return internal::sortedVector(std::move(begin), std::move(end), std::move(keySelector),
+                                      internal::ParallelRunner<Execution>(execution));
+    }
+}
+
+/**
+ * Copies `iterable` to a vector and sorts it stably by the key returned by `keySelector`. Every key is computed only once. If
+ * the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param iterable The sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::EnableIf<!std::is_execution_policy<KeySelector>::value, std::vector<internal::ValueTypeIterable<Iterable>>>
+sortedVector(const Iterable& iterable, KeySelector keySelector, Execution execution = std::execution::seq) {
+    return lz::sortedVector(std::begin(iterable), std::end(iterable), std::move(keySelector), execution);
+}
+
+/**
+ * Gets the indices that sort [begin, end) stably by the key returned by `keySelector`, without moving the elements. Every key is
+ * computed only once. If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The indices of the elements, in sorted order.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<std::size_t>
+argsort(Iterator begin, Iterator end, KeySelector keySelector, Execution execution = std::execution::seq) {
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        return internal::argsort(std::move(begin), std::move(end), std::move(keySelector), internal::SequentialRunner());
+    }
+    else {
+        return internal::argsort(std::move(begin), std::move(end), std::move(keySelector),
+                                 internal::ParallelRunner<Execution>(execution));
+    }
+}
+
+/**
+ * Gets the indices that sort `iterable` stably by the key returned by `keySelector`, without moving the elements. Every key is
+ * computed only once. If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param iterable The sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return The indices of the elements, in sorted order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<std::size_t>
+argsort(const Iterable& iterable, KeySelector keySelector, Execution execution = std::execution::seq) {
+    return lz::argsort(std::begin(iterable), std::end(iterable), std::move(keySelector), execution);
+}
 #    else // ^^^ Lz has execution vvv !Lz has execution
 
 /**
@@ -1123,7 +1422,7 @@ findLastOrDefaultIf(const Iterable& iterable, UnaryPredicate predicate, const T&
  */
 template<class Iterator, class T>
 std::size_t indexOf(Iterator begin, Iterator end, const T& val) {
-    const Iterator pos = std::find(begin, end, val);
+    const Iterator pos = internal::findValue(begin, end, val);
     return pos == end ? npos : static_cast<std::size_t>(std::distance(begin, pos));
 }
 
@@ -1175,7 +1474,7 @@ std::size_t indexOfIf(const Iterable& iterable, UnaryFunc predicate) {
  */
 template<class Iterator, class T>
 bool contains(Iterator begin, Iterator end, const T& value) {
-    return std::find(std::move(begin), end, value) != end;
+    return internal::findValue(std::move(begin), end, value) != end;
 }
 
 /**
@@ -1215,26 +1514,58 @@ bool containsIf(const Iterable& iterable, BinaryPredicate predicate) {
     return lz::containsIf(std::begin(iterable), std::end(iterable), std::move(predicate));
 }
 
+/**
+ * Checks whether [beginA, endA) starts with [beginB, endB). If both sequences are contiguous, have the same integral value type
+ * and `compare` is `std::equal_to`, `memcmp` is used.
+ * @param beginA The beginning of the sequence to check.
+ * @param endA The ending of the sequence to check.
+ * @param beginB The beginning of the prefix.
+ * @param endB The ending of the prefix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @return True if [beginA, endA) starts with [beginB, endB), false otherwise.
+ */
 template<class IteratorA, class IteratorB, class BinaryPredicate = MAKE_BIN_OP(std::equal_to, internal::ValueType<IteratorA>)>
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {}) {
-    return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+    return internal::rangeStartsWith(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare));
 }
 
+/**
+ * Checks whether `a` starts with `b`. If both sequences are contiguous, have the same integral value type and `compare` is
+ * `std::equal_to`, `memcmp` is used.
+ * @param a The sequence to check.
+ * @param b The prefix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @return True if `a` starts with `b`, false otherwise.
+ */
 template<class IterableA, class IterableB,
          class BinaryPredicate = MAKE_BIN_OP(std::equal_to, internal::ValueTypeIterable<IterableA>)>
 bool startsWith(const IterableA& a, const IterableB& b, BinaryPredicate compare = {}) {
     return lz::startsWith(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(compare));
 }
 
+/**
+ * Checks whether [beginA, endA) ends with [beginB, endB). If both sequences are contiguous, have the same integral value type
+ * and `compare` is `std::equal_to`, `memcmp` is used.
+ * @param beginA The beginning of the sequence to check.
+ * @param endA The ending of the sequence to check.
+ * @param beginB The beginning of the suffix.
+ * @param endB The ending of the suffix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @return True if [beginA, endA) ends with [beginB, endB), false otherwise.
+ */
 template<class IteratorA, class IteratorB, class BinaryPredicate = MAKE_BIN_OP(std::equal_to, internal::ValueType<IteratorA>)>
 bool endsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {}) {
-    std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
-    std::reverse_iterator<IteratorA> revBegA(std::move(endA));
-    std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
-    std::reverse_iterator<IteratorB> revBegB(std::move(endB));
-    return lz::startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB), std::move(compare));
+    return internal::rangeEndsWith(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare));
 }
 
+/**
+ * Checks whether `a` ends with `b`. If both sequences are contiguous, have the same integral value type and `compare` is
+ * `std::equal_to`, `memcmp` is used.
+ * @param a The sequence to check.
+ * @param b The suffix.
+ * @param compare The comparer, `std::equal_to` by default.
+ * @return True if `a` ends with `b`, false otherwise.
+ */
 template<class IterableA, class IterableB,
          class BinaryPredicate = MAKE_BIN_OP(std::equal_to, internal::ValueTypeIterable<IterableA>)>
 bool endsWith(const IterableA& a, const IterableB& b, BinaryPredicate compare = {}) {
@@ -1365,6 +1696,99 @@ trimString(const std::string& s) {
     return lz::trimString(s.begin(), s.end());
 }
 
+/**
+ * Sorts [begin, end) ascending. If the value type is an integral or floating point type, a radix sort is used instead of
+ * `std::sort`.
+ * @param begin The beginning of the sequence to sort.
+ * @param end The ending of the sequence to sort.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+void sortInPlace(Iterator begin, Iterator end) {
+    internal::sortInPlace(std::move(begin), std::move(end), internal::SequentialRunner());
+}
+
+/**
+ * Sorts `iterable` ascending. If the value type is an integral or floating point type, a radix sort is used instead of
+ * `std::sort`.
+ * @param iterable The sequence to sort.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+void sortInPlace(Iterable& iterable) {
+    lz::sortInPlace(std::begin(iterable), std::end(iterable));
+}
+
+/**
+ * Copies [begin, end) to a vector and sorts it ascending. If the value type is an integral or floating point type, a radix sort
+ * is used instead of `std::sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>> sortedVector(Iterator begin, Iterator end) {
+    return internal::sortedVector(std::move(begin), std::move(end), internal::SequentialRunner());
+}
+
+/**
+ * Copies `iterable` to a vector and sorts it ascending. If the value type is an integral or floating point type, a radix sort
+ * is used instead of `std::sort`.
+ * @param iterable The sequence.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>> sortedVector(const Iterable& iterable) {
+    return lz::sortedVector(std::begin(iterable), std::end(iterable));
+}
+
+/**
+ * Copies [begin, end) to a vector and sorts it stably by the key returned by `keySelector`. Every key is computed only once.
+ * If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>> sortedVector(Iterator begin, Iterator end, KeySelector keySelector) {
+    return internal::sortedVector(std::move(begin), std::move(end), std::move(keySelector), internal::SequentialRunner());
+}
+
+/**
+ * Copies `iterable` to a vector and sorts it stably by the key returned by `keySelector`. Every key is computed only once. If
+ * the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param iterable The sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @return The sorted vector.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>> sortedVector(const Iterable& iterable, KeySelector keySelector) {
+    return lz::sortedVector(std::begin(iterable), std::end(iterable), std::move(keySelector));
+}
+
+/**
+ * Gets the indices that sort [begin, end) stably by the key returned by `keySelector`, without moving the elements. Every key is
+ * computed only once. If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @return The indices of the elements, in sorted order.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector>
+LZ_NODISCARD std::vector<std::size_t> argsort(Iterator begin, Iterator end, KeySelector keySelector) {
+    return internal::argsort(std::move(begin), std::move(end), std::move(keySelector), internal::SequentialRunner());
+}
+
+/**
+ * Gets the indices that sort `iterable` stably by the key returned by `keySelector`, without moving the elements. Every key is
+ * computed only once. If the key is an integral or floating point type, a radix sort is used instead of `std::stable_sort`.
+ * @param iterable The sequence.
+ * @param keySelector Function that returns the key to sort on, for every element.
+ * @return The indices of the elements, in sorted order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector>
+LZ_NODISCARD std::vector<std::size_t> argsort(const Iterable& iterable, KeySelector keySelector) {
+    return lz::argsort(std::begin(iterable), std::end(iterable), std::move(keySelector));
+}
 #    endif // End LZ_HAS_EXECUTION
 } // End namespace lz
 
@@ -3,14 +3,20 @@
 #ifndef LZ_LZ_HPP
 #    define LZ_LZ_HPP
 
+#    include "Lz/AsyncBuffer.hpp"
 #    include "Lz/CString.hpp"
+#    include "Lz/Cache.hpp"
 #    include "Lz/CartesianProduct.hpp"
 #    include "Lz/ChunkIf.hpp"
 #    include "Lz/Chunks.hpp"
+#    include "Lz/Coroutine.hpp"
 #    include "Lz/Enumerate.hpp"
 #    include "Lz/Except.hpp"
 #    include "Lz/Exclude.hpp"
 #    include "Lz/ExclusiveScan.hpp"
+#    include "Lz/Expression.hpp"
+#    include "Lz/ExternalSort.hpp"
+#    include "Lz/FilterBatch.hpp"
 #    include "Lz/Flatten.hpp"
 #    include "Lz/FunctionTools.hpp"
 #    include "Lz/Generate.hpp"
@@ -18,12 +24,24 @@
 #    include "Lz/InclusiveScan.hpp"
 #    include "Lz/JoinWhere.hpp"
 #    include "Lz/Loop.hpp"
+#    include "Lz/MapBatch.hpp"
+#    include "Lz/MergeSorted.hpp"
+#    include "Lz/Parallel.hpp"
+#    include "Lz/ParallelMap.hpp"
+#    include "Lz/Quantiles.hpp"
 #    include "Lz/Random.hpp"
 #    include "Lz/Range.hpp"
 #    include "Lz/Repeat.hpp"
 #    include "Lz/Rotate.hpp"
+#    include "Lz/Sliding.hpp"
+#    include "Lz/Sorted.hpp"
+#    include "Lz/Stats.hpp"
 #    include "Lz/TakeEvery.hpp"
+#    include "Lz/Tee.hpp"
+#    include "Lz/ThreadPool.hpp"
+#    include "Lz/TopK.hpp"
 #    include "Lz/Unique.hpp"
+#    include "Lz/Window.hpp"
 #    include "Lz/ZipLongest.hpp"
 
 // Function tools includes:
@@ -135,6 +153,13 @@ public:
         return chain(lz::map(*this, std::move(unaryFunction)));
     }
 
+    //! See MapBatch.hpp for documentation
+    template<class T = value_type, class BatchFunction>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapBatchIterator<Iterator, BatchFunction, T>>
+    mapBatch(BatchFunction batchFunction, const std::size_t blockSize = 64) const {
+        return chain(lz::mapBatch<T>(*this, std::move(batchFunction), blockSize));
+    }
+
     //! See Take.hpp for documentation.
     template<class UnaryPredicate>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator> takeWhile(UnaryPredicate predicate) const {
@@ -168,6 +193,209 @@ public:
         return chain(lz::chunks(*this, chunkSize));
     }
 
+    //! See Window.hpp for documentation
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::WindowIterator<Iterator>> window(const std::size_t windowSize) const {
+        return chain(lz::window(*this, windowSize));
+    }
+
+    //! See Sliding.hpp for documentation
+    LZ_NODISCARD IterView<internal::SlidingIterator<Iterator, internal::SlidingSumAggregate<value_type>>>
+    slidingSum(const std::size_t windowSize) const {
+        return chain(lz::slidingSum(*this, windowSize));
+    }
+
+    //! See Sliding.hpp for documentation
+    LZ_NODISCARD IterView<internal::SlidingIterator<Iterator, internal::SlidingMeanAggregate<value_type>>>
+    slidingMean(const std::size_t windowSize) const {
+        return chain(lz::slidingMean(*this, windowSize));
+    }
+
+    //! See Sliding.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    LZ_NODISCARD IterView<internal::SlidingIterator<Iterator, internal::SlidingExtremeAggregate<value_type, Compare, false>>>
+    slidingMin(const std::size_t windowSize, Compare compare = {}) const {
+        return chain(lz::slidingMin(*this, windowSize, std::move(compare)));
+    }
+
+    //! See Sliding.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    LZ_NODISCARD IterView<internal::SlidingIterator<Iterator, internal::SlidingExtremeAggregate<value_type, Compare, true>>>
+    slidingMax(const std::size_t windowSize, Compare compare = {}) const {
+        return chain(lz::slidingMax(*this, windowSize, std::move(compare)));
+    }
+
+    //! See Cache.hpp for documentation
+    LZ_NODISCARD IterView<internal::CacheIterator<Iterator>> cache() const {
+        return chain(lz::cache(*this));
+    }
+
+    //! See Cache.hpp for documentation
+    LZ_NODISCARD IterView<internal::CacheLastIterator<Iterator>> cacheLast() const {
+        return chain(lz::cacheLast(*this));
+    }
+
+    //! See FunctionTools.hpp `filterMapOpt` for documentation
+    template<class Function>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterMapOptIterator<Iterator, Function>>
+    filterMapOpt(Function function) const {
+        return chain(lz::filterMapOpt(*this, std::move(function)));
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class TrueContainer, class FalseContainer, class UnaryPredicate>
+    const IterView<Iterator>& partitionTo(TrueContainer& outTrue, FalseContainer& outFalse, UnaryPredicate predicate) const {
+        lz::partitionTo(*this, outTrue, outFalse, std::move(predicate));
+        return *this;
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class... Containers>
+    const IterView<Iterator>& unzipTo(Containers&... outputs) const {
+        lz::unzipTo(*this, outputs...);
+        return *this;
+    }
+
+    //! See Parallel.hpp for documentation
+    LZ_NODISCARD std::vector<internal::BasicIteratorView<Iterator>> splitInto(const std::size_t parts) const {
+        return lz::splitInto(*this, parts);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class Function, class Executor = ThreadPool>
+    const IterView<Iterator>&
+    parallelForEach(const Function& function, const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        lz::parallelForEach(*this, function, parts, executor);
+        return *this;
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class Function>
+    const IterView<Iterator>& parallelForEachChunked(const Function& function, const std::size_t grain = 0,
+                                                     const std::size_t maxInFlight = 0,
+                                                     ThreadPool& pool = ThreadPool::global()) const {
+        lz::parallelForEachChunked(*this, function, grain, maxInFlight, pool);
+        return *this;
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class T, class Function, class Executor = ThreadPool>
+    LZ_NODISCARD T parallelFoldl(const T& init, const Function& function, const std::size_t parts = 0,
+                                 Executor& executor = ThreadPool::global()) const {
+        return lz::parallelFoldl(*this, init, function, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class T, class Function, class Combine, class Executor = ThreadPool>
+    LZ_NODISCARD internal::EnableIf<!std::is_integral<Combine>::value, T>
+    parallelFoldl(const T& init, const Function& function, Combine combine, const std::size_t parts = 0,
+                  Executor& executor = ThreadPool::global()) const {
+        return lz::parallelFoldl(*this, init, function, std::move(combine), parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class T, class Function, class Executor = ThreadPool>
+    LZ_NODISCARD T parallelFoldlDeterministic(const T& init, const Function& function, const std::size_t blockSize = 0,
+                                              const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        return lz::parallelFoldlDeterministic(*this, init, function, blockSize, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class T, class Function, class Combine, class Executor = ThreadPool>
+    LZ_NODISCARD internal::EnableIf<!std::is_integral<Combine>::value, T>
+    parallelFoldlDeterministic(const T& init, const Function& function, Combine combine, const std::size_t blockSize = 0,
+                               const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        return lz::parallelFoldlDeterministic(*this, init, function, std::move(combine), blockSize, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class Executor = ThreadPool>
+    LZ_NODISCARD value_type parallelSumDeterministic(const std::size_t blockSize = 0, const std::size_t parts = 0,
+                                                     Executor& executor = ThreadPool::global()) const {
+        return lz::parallelSumDeterministic(*this, blockSize, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class Executor = ThreadPool>
+    LZ_NODISCARD std::vector<value_type>
+    parallelToVector(const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        return lz::parallelToVector(*this, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class T, class Executor = ThreadPool>
+    LZ_NODISCARD difference_type
+    parallelCount(const T& value, const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        return lz::parallelCount(*this, value, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class UnaryPredicate, class Executor = ThreadPool>
+    LZ_NODISCARD difference_type
+    parallelCountIf(const UnaryPredicate& predicate, const std::size_t parts = 0,
+                    Executor& executor = ThreadPool::global()) const {
+        return lz::parallelCountIf(*this, predicate, parts, executor);
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class TrueContainer, class FalseContainer, class UnaryPredicate, class Executor = ThreadPool>
+    const IterView<Iterator>&
+    parallelPartitionTo(TrueContainer& outTrue, FalseContainer& outFalse, const UnaryPredicate& predicate,
+                        const std::size_t parts = 0, Executor& executor = ThreadPool::global()) const {
+        lz::parallelPartitionTo(*this, outTrue, outFalse, predicate, parts, executor);
+        return *this;
+    }
+
+    //! See Parallel.hpp for documentation
+    template<class... Containers, class Executor = ThreadPool>
+    const IterView<Iterator>& parallelUnzipTo(std::tuple<Containers&...> outputs, const std::size_t parts = 0,
+                                              Executor& executor = ThreadPool::global()) const {
+        lz::parallelUnzipTo(*this, std::move(outputs), parts, executor);
+        return *this;
+    }
+
+    //! See ParallelMap.hpp for documentation
+    template<class UnaryFunction>
+    LZ_NODISCARD IterView<internal::ParallelMapIterator<Iterator, UnaryFunction, ThreadPool, true>>
+    parallelMap(UnaryFunction unaryFunction, const std::size_t window = 0, ThreadPool& pool = ThreadPool::global()) const {
+        return chain(lz::parallelMap(*this, std::move(unaryFunction), window, pool));
+    }
+
+    //! See ParallelMap.hpp for documentation
+    template<class UnaryFunction>
+    LZ_NODISCARD IterView<internal::ParallelMapIterator<Iterator, UnaryFunction, ThreadPool, false>>
+    parallelMapUnordered(UnaryFunction unaryFunction, const std::size_t window = 0,
+                         ThreadPool& pool = ThreadPool::global()) const {
+        return chain(lz::parallelMapUnordered(*this, std::move(unaryFunction), window, pool));
+    }
+
+    //! See AsyncBuffer.hpp for documentation
+    LZ_NODISCARD IterView<internal::AsyncBufferIterator<Iterator>> asyncBuffer(const std::size_t capacity = 64) const {
+        return chain(lz::asyncBuffer(*this, capacity));
+    }
+
+    //! See Tee.hpp for documentation
+    LZ_NODISCARD std::vector<IterView<internal::TeeIterator<Iterator>>> tee(const std::size_t n) const {
+        std::vector<IterView<internal::TeeIterator<Iterator>>> views;
+        views.reserve(n);
+        for (Tee<Iterator>& view : lz::tee(*this, n)) {
+            views.push_back(chain(view));
+        }
+        return views;
+    }
+
+    //! See Tee.hpp for documentation
+    template<class... Sinks>
+    std::tuple<internal::Decay<Sinks>...> fanout(Sinks&&... sinks) const {
+        return lz::fanout(*this, std::forward<Sinks>(sinks)...);
+    }
+
+#    ifdef LZ_HAS_COROUTINES
+    //! See Coroutine.hpp for documentation
+    LZ_NODISCARD Generator<value_type> toGenerator() const {
+        return lz::toGenerator(*this);
+    }
+#    endif // LZ_HAS_COROUTINES
+
     //! See Zip.hpp for documentation.
     template<LZ_CONCEPT_ITERABLE... Iterables>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::ZipIterator<Iterator, internal::IterTypeFromIterable<Iterables>>...>
@@ -227,6 +455,35 @@ public:
         return chain(lz::exclude(*this, from, to));
     }
     
+    //! See FilterBatch.hpp for documentation.
+    template<class BatchPredicate>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterBatchIterator<Iterator, BatchPredicate>>
+    filterBatch(BatchPredicate predicate) const {
+        return chain(lz::filterBatch(*this, std::move(predicate)));
+    }
+
+    //! See MergeSorted.hpp for documentation.
+    template<class Compare, class... Iterables>
+    LZ_NODISCARD IterView<
+        internal::MergeSortedIterator<internal::TupleSources<Iterator, internal::IterTypeFromIterable<Iterables>...>, Compare, false>>
+    mergeSorted(Compare compare, Iterables&&... iterables) const {
+        return chain(lz::mergeSorted(std::move(compare), *this, std::forward<Iterables>(iterables)...));
+    }
+
+    //! See Sorted.hpp for documentation.
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    LZ_NODISCARD IterView<internal::SortedIterator<value_type, Compare>> sorted(Compare compare = {}) const {
+        return chain(lz::sorted(*this, std::move(compare)));
+    }
+
+    //! See ExternalSort.hpp for documentation.
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    LZ_NODISCARD IterView<internal::ExternalSortIterator<value_type, Compare>>
+    externalSort(Compare compare = {}, const std::size_t memoryBudget = std::size_t{ 64 } << 20,
+                 const std::string& directory = {}) const {
+        return chain(lz::externalSort(*this, std::move(compare), memoryBudget, directory));
+    }
+
     // clang-format off
     //! See InclusiveScan.hpp for documentation.
     template<class T = value_type, class BinaryOp = MAKE_BIN_OP(std::plus, internal::ValueType<iterator>)>
@@ -272,6 +529,11 @@ public:
         return lz::backOr(*this, defaultValue);
     }
 
+    //! See Quantiles.hpp `approxQuantiles` for documentation.
+    LZ_NODISCARD std::vector<value_type> approxQuantiles(const std::vector<double>& probabilities, const std::size_t k = 200) const {
+        return lz::approxQuantiles(*this, probabilities, k);
+    }
+
 #    ifdef LZ_HAS_EXECUTION
     //! See Filter.hpp for documentation.
     template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
@@ -456,7 +718,9 @@ public:
 
     /**
      * Performs a left fold with as starting point `init`. Can be used to for e.g. sum all values. For this use:
-     * `[](value_type init, value_type next) const { return init + value_type; }`
+     * `[](value_type init, value_type next) const { return init + value_type; }`. With a parallel execution policy, the
+     * elements are combined in an unspecified order, so floating point results may differ between runs. See
+     * `lz::parallelFoldlDeterministic` for a parallel fold that does not.
      * @param init The starting value
      * @param function A binary function with the following signature `value_type func(value_type init, value_type element)`
      */
@@ -464,7 +728,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T foldl(T&& init, BinaryFunction function, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            return std::accumulate(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
         else {
             return std::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
@@ -482,8 +746,8 @@ public:
         auto reverseView = reverse();
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
-                               std::forward<T>(init), std::move(function));
+            return std::accumulate(internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
+                                   std::forward<T>(init), std::move(function));
         }
         else {
             return std::reduce(execution, internal::begin(std::move(reverseView)), internal::end(std::move(reverseView)),
@@ -548,6 +812,41 @@ public:
         return lz::median(*this, std::move(compare), execution);
     }
 
+    //! See Stats.hpp for documentation
+    template<class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Stats<value_type> stats(Execution execution = std::execution::seq) const {
+        return lz::stats(*this, execution);
+    }
+
+    //! See Quantiles.hpp for documentation
+    template<class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<double>
+    quantiles(const std::vector<double>& probabilities, Execution execution = std::execution::seq) const {
+        return lz::quantiles(*this, probabilities, execution);
+    }
+
+    //! See TopK.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type), class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type>
+    topK(const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) const {
+        return lz::topK(*this, k, std::move(compare), execution);
+    }
+
+    //! See TopK.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type), class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type>
+    bottomK(const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) const {
+        return lz::bottomK(*this, k, std::move(compare), execution);
+    }
+
+    //! See TopK.hpp for documentation
+    template<class KeySelector, class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const value_type&>>,
+             class Compare = MAKE_BIN_OP(std::less, Key), class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type>
+    topKBy(const std::size_t k, KeySelector keySelector, Compare compare = {}, Execution execution = std::execution::seq) const {
+        return lz::topKBy(*this, k, std::move(keySelector), std::move(compare), execution);
+    }
+
     /**
      * Checks if all of the elements meet the condition `predicate`. `predicate` must return a bool and take a `value_type` as
      * parameter.
@@ -608,7 +907,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type count(const T& value, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count(Base::begin(), Base::end(), value);
+            return internal::countValue(Base::begin(), Base::end(), value);
         }
         else {
             return std::count(execution, Base::begin(), Base::end(), value);
@@ -895,6 +1194,35 @@ public:
         return lz::median(*this, std::move(compare));
     }
 
+    //! See Stats.hpp for documentation
+    Stats<value_type> stats() const {
+        return lz::stats(*this);
+    }
+
+    //! See Quantiles.hpp for documentation
+    std::vector<double> quantiles(const std::vector<double>& probabilities) const {
+        return lz::quantiles(*this, probabilities);
+    }
+
+    //! See TopK.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    std::vector<value_type> topK(const std::size_t k, Compare compare = {}) const {
+        return lz::topK(*this, k, std::move(compare));
+    }
+
+    //! See TopK.hpp for documentation
+    template<class Compare = MAKE_BIN_OP(std::less, value_type)>
+    std::vector<value_type> bottomK(const std::size_t k, Compare compare = {}) const {
+        return lz::bottomK(*this, k, std::move(compare));
+    }
+
+    //! See TopK.hpp for documentation
+    template<class KeySelector, class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const value_type&>>,
+             class Compare = MAKE_BIN_OP(std::less, Key)>
+    std::vector<value_type> topKBy(const std::size_t k, KeySelector keySelector, Compare compare = {}) const {
+        return lz::topKBy(*this, k, std::move(keySelector), std::move(compare));
+    }
+
     /**
      * Checks if all of the elements meet the condition `predicate`. `predicate` must return a bool and take a `value_type` as
      * parameter.
@@ -932,7 +1260,7 @@ public:
      */
     template<class T>
     difference_type count(const T& value) const {
-        return std::count(Base::begin(), Base::end(), value);
+        return internal::countValue(Base::begin(), Base::end(), value);
     }
 
     /**
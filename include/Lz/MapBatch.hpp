@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef LZ_MAP_BATCH_HPP
+#    define LZ_MAP_BATCH_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/MapBatchIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator, class BatchFunction, class T>
+class MapBatch final : public internal::BasicIteratorView<internal::MapBatchIterator<Iterator, BatchFunction, T>> {
+public:
+    using iterator = internal::MapBatchIterator<Iterator, BatchFunction, T>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 MapBatch(Iterator begin, Iterator end, BatchFunction function, const std::size_t blockSize) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, function, blockSize), iterator(end, end, function, blockSize)) {
+    }
+
+    constexpr MapBatch() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a forward map iterator that transforms `blockSize` elements at once instead of one at a time.
+ * @details The function is called as `function(const value_type* in, T* out, std::size_t count)` and must write `count`
+ * transformed elements to `out`. This allows (SIMD) kernels, such as conversions or math functions, to be used inside a lazy
+ * sequence while iterating over it element by element. A block is only transformed when one of its elements is dereferenced.
+ * Copies of an iterator that has been dereferenced share its transformed block instead of copying it, so they are not thread
+ * safe.
+ * If the sequence is contiguous (e.g. `std::vector` or a pointer), `in` points directly into the sequence. Otherwise, the
+ * block is copied into an internal buffer first. `T` is the type of the transformed elements, and must be default
+ * constructible. It defaults to the value type of the sequence. I.e.
+ * `lz::mapBatch<float>(ints, [](const int* in, float* out, std::size_t n) { for (std::size_t i = 0; i < n; ++i) out[i] =
+ * static_cast<float>(in[i]) * 0.5f; })`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function A function that transforms a block of `count` elements from `in` to `out`.
+ * @param blockSize The (maximum) amount of elements that are transformed at once.
+ * @return A MapBatch object from [begin, end) that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class T = void, LZ_CONCEPT_ITERATOR Iterator, class BatchFunction,
+         class Out = internal::Conditional<std::is_void<T>::value, internal::ValueType<Iterator>, T>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MapBatch<Iterator, BatchFunction, Out>
+mapBatchRange(Iterator begin, Iterator end, BatchFunction function, const std::size_t blockSize = 64) {
+    static_assert(internal::IsForward<Iterator>::value, "Iterator must be at least a forward iterator");
+    static_assert(std::is_default_constructible<Out>::value, "the output type must be default constructible");
+    return { std::move(begin), std::move(end), std::move(function), blockSize };
+}
+
+/**
+ * @brief Returns a forward map iterator that transforms `blockSize` elements at once instead of one at a time.
+ * @details The function is called as `function(const value_type* in, T* out, std::size_t count)` and must write `count`
+ * transformed elements to `out`. This allows (SIMD) kernels, such as conversions or math functions, to be used inside a lazy
+ * sequence while iterating over it element by element. A block is only transformed when one of its elements is dereferenced.
+ * Copies of an iterator that has been dereferenced share its transformed block instead of copying it, so they are not thread
+ * safe.
+ * If the sequence is contiguous (e.g. `std::vector` or a pointer), `in` points directly into the sequence. Otherwise, the
+ * block is copied into an internal buffer first. `T` is the type of the transformed elements, and must be default
+ * constructible. It defaults to the value type of the sequence.
+ * @param iterable The sequence to transform.
+ * @param function A function that transforms a block of `count` elements from `in` to `out`.
+ * @param blockSize The (maximum) amount of elements that are transformed at once.
+ * @return A MapBatch object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class T = void, LZ_CONCEPT_ITERABLE Iterable, class BatchFunction, class I = internal::IterTypeFromIterable<Iterable>,
+         class Out = internal::Conditional<std::is_void<T>::value, internal::ValueType<I>, T>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MapBatch<I, BatchFunction, Out>
+mapBatch(Iterable&& iterable, BatchFunction function, const std::size_t blockSize = 64) {
+    return mapBatchRange<Out>(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              std::move(function), blockSize);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_MAP_BATCH_HPP
@@ -0,0 +1,136 @@
+#pragma once
+
+#ifndef LZ_MERGE_SORTED_HPP
+#    define LZ_MERGE_SORTED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/MergeSortedIterator.hpp"
+
+namespace lz {
+namespace internal {
+template<class... Iterables>
+std::pair<TupleSources<IterTypeFromIterable<Iterables>...>, TupleSources<IterTypeFromIterable<Iterables>...>>
+makeTupleSources(Iterables&&... iterables) {
+    using Sources = TupleSources<IterTypeFromIterable<Iterables>...>;
+    auto ends = std::make_tuple(internal::end(std::forward<Iterables>(iterables))...);
+    return { Sources(std::make_tuple(internal::begin(std::forward<Iterables>(iterables))...), ends), Sources(ends, ends) };
+}
+
+template<class Iterable>
+using VectorSourcesFor = VectorSources<decltype(std::begin(std::declval<const Iterable&>()))>;
+
+template<class Iterable>
+std::pair<VectorSourcesFor<Iterable>, VectorSourcesFor<Iterable>> makeVectorSources(const std::vector<Iterable>& iterables) {
+    using Iterator = decltype(std::begin(std::declval<const Iterable&>()));
+    std::vector<Iterator> begins;
+    auto ends = std::make_shared<std::vector<Iterator>>();
+    begins.reserve(iterables.size());
+    ends->reserve(iterables.size());
+    for (const Iterable& iterable : iterables) {
+        begins.push_back(std::begin(iterable));
+        ends->push_back(std::end(iterable));
+    }
+    std::vector<Iterator> endPositions = *ends;
+    return { VectorSources<Iterator>(std::move(begins), ends), VectorSources<Iterator>(std::move(endPositions), ends) };
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class Sources, class Compare, bool Unique>
+class MergeSorted final : public internal::BasicIteratorView<internal::MergeSortedIterator<Sources, Compare, Unique>> {
+public:
+    using iterator = internal::MergeSortedIterator<Sources, Compare, Unique>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    MergeSorted(Sources begin, Sources end, Compare compare) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), compare), iterator(std::move(end), compare)) {
+    }
+
+    MergeSorted() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Merges multiple sorted sequences lazily into one sorted sequence, without copying or re-sorting them.
+ * @details The merge uses a loser tree, so every element takes O(log k) comparisons, where k is the amount of sequences. The
+ * merge is stable: equal elements are returned in the order of the sequences they come from. Every sequence must be sorted
+ * according to `compare`. I.e. `lz::mergeSorted(std::less<int>(), a, b, c)`.
+ * @param compare The comparer that is used to sort the sequences. I.e. `std::less<int>()`.
+ * @param first The first sorted sequence.
+ * @param rest The other sorted sequences. Their reference types must have a common type.
+ * @return A MergeSorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Compare, LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE... Iterables>
+LZ_NODISCARD MergeSorted<internal::TupleSources<internal::IterTypeFromIterable<Iterable>, internal::IterTypeFromIterable<Iterables>...>,
+                         Compare, false>
+mergeSorted(Compare compare, Iterable&& first, Iterables&&... rest) {
+    auto sources = internal::makeTupleSources(std::forward<Iterable>(first), std::forward<Iterables>(rest)...);
+    return { std::move(sources.first), std::move(sources.second), std::move(compare) };
+}
+
+/**
+ * @brief Merges multiple sorted sequences lazily into one sorted sequence, and collapses equal elements into one.
+ * @details The merge uses a loser tree, so every element takes O(log k) comparisons, where k is the amount of sequences. Of
+ * every group of equal elements, only the first is returned. Every sequence must be sorted according to `compare`. I.e.
+ * `lz::mergeSortedUnique(std::less<int>(), a, b, c)`.
+ * @param compare The comparer that is used to sort the sequences. I.e. `std::less<int>()`.
+ * @param first The first sorted sequence.
+ * @param rest The other sorted sequences. Their reference types must have a common type.
+ * @return A MergeSorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Compare, LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE... Iterables>
+LZ_NODISCARD MergeSorted<internal::TupleSources<internal::IterTypeFromIterable<Iterable>, internal::IterTypeFromIterable<Iterables>...>,
+                         Compare, true>
+mergeSortedUnique(Compare compare, Iterable&& first, Iterables&&... rest) {
+    auto sources = internal::makeTupleSources(std::forward<Iterable>(first), std::forward<Iterables>(rest)...);
+    return { std::move(sources.first), std::move(sources.second), std::move(compare) };
+}
+
+/**
+ * @brief Merges a runtime amount of sorted sequences lazily into one sorted sequence, without copying or re-sorting them.
+ * @details The merge uses a loser tree, so every element takes O(log k) comparisons, where k is the amount of sequences. The
+ * merge is stable: equal elements are returned in the order of the sequences they come from. Every sequence must be sorted
+ * according to `compare`. The vector must outlive the returned view.
+ * @param iterables The sorted sequences.
+ * @param compare The comparer that is used to sort the sequences. `operator<` is assumed by default.
+ * @return A MergeSorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD MergeSorted<internal::VectorSourcesFor<Iterable>, Compare, false>
+mergeSorted(const std::vector<Iterable>& iterables, Compare compare = {}) {
+    auto sources = internal::makeVectorSources(iterables);
+    return { std::move(sources.first), std::move(sources.second), std::move(compare) };
+}
+
+/**
+ * @brief Merges a runtime amount of sorted sequences lazily into one sorted sequence, and collapses equal elements into one.
+ * @details The merge uses a loser tree, so every element takes O(log k) comparisons, where k is the amount of sequences. Of
+ * every group of equal elements, only the first is returned. Every sequence must be sorted according to `compare`. The vector
+ * must outlive the returned view.
+ * @param iterables The sorted sequences.
+ * @param compare The comparer that is used to sort the sequences. `operator<` is assumed by default.
+ * @return A MergeSorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD MergeSorted<internal::VectorSourcesFor<Iterable>, Compare, true>
+mergeSortedUnique(const std::vector<Iterable>& iterables, Compare compare = {}) {
+    auto sources = internal::makeVectorSources(iterables);
+    return { std::move(sources.first), std::move(sources.second), std::move(compare) };
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_MERGE_SORTED_HPP
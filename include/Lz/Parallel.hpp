@@ -0,0 +1,598 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_HPP
+#    define LZ_PARALLEL_HPP
+
+#    include "FunctionTools.hpp"
+#    include "ThreadPool.hpp"
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/Split.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <exception>
+#    include <functional>
+#    include <iterator>
+#    include <memory>
+#    include <mutex>
+#    include <numeric>
+#    include <tuple>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+template<class Iterator>
+std::vector<BasicIteratorView<Iterator>>
+splitIfPossible(Iterator begin, Iterator end, const std::size_t parts, std::true_type /* splittable */) {
+    return splitRange(begin, end, parts == 0 ? defaultParts() : parts);
+}
+
+// Views that cannot be split are processed as a whole, on the calling thread
+template<class Iterator>
+std::vector<BasicIteratorView<Iterator>>
+splitIfPossible(Iterator begin, Iterator end, std::size_t, std::false_type /* splittable */) {
+    std::vector<BasicIteratorView<Iterator>> views;
+    views.emplace_back(std::move(begin), std::move(end));
+    return views;
+}
+
+template<class Iterator>
+std::vector<BasicIteratorView<Iterator>> splitIfPossible(Iterator begin, Iterator end, const std::size_t parts) {
+    return splitIfPossible(std::move(begin), std::move(end), parts, IsSplittable<Iterator>());
+}
+
+template<class Iterator, class Function, class Executor>
+void parallelForEach(Iterator begin, Iterator end, const Function& function, const std::size_t parts, Executor& executor,
+                     std::true_type /* splittable */) {
+    const std::vector<BasicIteratorView<Iterator>> views = splitRange(begin, end, parts == 0 ? defaultParts() : parts);
+    executor.run(views.size(), [&](const std::size_t part) {
+        Function partFunction = function;
+        for (auto&& value : views[part]) {
+            partFunction(value);
+        }
+    });
+}
+
+template<class Iterator, class Function, class Executor>
+void parallelForEach(Iterator begin, Iterator end, Function function, std::size_t, Executor&, std::false_type /* splittable */) {
+    for (; begin != end; ++begin) {
+        function(*begin);
+    }
+}
+
+// The amount of elements per chunk of `lz::parallelForEachChunked` if no grain is given
+constexpr std::size_t DefaultGrain = 128;
+
+struct ChunkedState {
+    std::atomic<std::size_t> inFlight{ 0 };
+    std::atomic<bool> failed{ false };
+    std::mutex mutex{};
+    std::exception_ptr error{};
+
+    void fail(std::exception_ptr exception) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = std::move(exception);
+        }
+        failed = true;
+    }
+};
+
+template<class T, class Function>
+struct ChunkTask {
+    std::shared_ptr<std::vector<T>> chunk;
+    std::shared_ptr<ChunkedState> state;
+    Function function;
+
+    void operator()() {
+        if (!state->failed) {
+            try {
+                for (auto&& value : *chunk) {
+                    function(value);
+                }
+            }
+            catch (...) {
+                state->fail(std::current_exception());
+            }
+        }
+        --state->inFlight;
+    }
+};
+
+// The calling thread is the only producer: it copies chunks of `grain` elements from the view, which are processed by the
+// workers of the pool. No more than `maxInFlight` chunks are buffered or being processed at any time. While the producer waits
+// for chunks to finish, it runs tasks of the pool itself. No new chunks are produced after `function` has thrown
+template<class Iterator, class Function>
+void parallelForEachChunked(Iterator begin, const Iterator& end, const Function& function, std::size_t grain,
+                            std::size_t maxInFlight, ThreadPool& pool) {
+    using T = ValueType<Iterator>;
+    if (grain == 0) {
+        grain = DefaultGrain;
+    }
+    if (maxInFlight == 0) {
+        maxInFlight = 2 * pool.size();
+    }
+
+    const auto state = std::make_shared<ChunkedState>();
+    const auto waitUntil = [&pool, &state](const std::size_t inFlight) {
+        pool.waitUntil([&state, inFlight] { return state->inFlight <= inFlight; });
+    };
+
+    try {
+        while (begin != end && !state->failed) {
+            waitUntil(maxInFlight - 1);
+            auto chunk = std::make_shared<std::vector<T>>();
+            chunk->reserve(grain);
+            for (; begin != end && chunk->size() < grain; ++begin) {
+                chunk->push_back(*begin);
+            }
+            ++state->inFlight;
+            pool.submit(ChunkTask<T, Function>{ std::move(chunk), state, function });
+        }
+    }
+    catch (...) {
+        waitUntil(0);
+        throw;
+    }
+    waitUntil(0);
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+template<class Iterator, class T, class Function>
+T foldlPart(Iterator begin, const Iterator& end, T init, Function function) {
+    for (; begin != end; ++begin) {
+        init = function(std::move(init), *begin);
+    }
+    return init;
+}
+
+// The size of a splittable view is known, so every part can write its elements directly to its own slice of the result
+template<class Iterator, class Executor>
+std::vector<ValueType<Iterator>> parallelToVector(const std::vector<BasicIteratorView<Iterator>>& views, Executor& executor,
+                                                  std::true_type /* default constructible */) {
+    const Iterator first = views.front().begin();
+    std::vector<ValueType<Iterator>> result(static_cast<std::size_t>(views.back().end() - first));
+    executor.run(views.size(), [&](const std::size_t part) {
+        const BasicIteratorView<Iterator>& view = views[part];
+        std::copy(view.begin(), view.end(), result.begin() + (view.begin() - first));
+    });
+    return result;
+}
+
+// Values that cannot be default constructed are collected per part, after which the parts are concatenated
+template<class Iterator, class Executor>
+std::vector<ValueType<Iterator>> parallelToVector(const std::vector<BasicIteratorView<Iterator>>& views, Executor& executor,
+                                                  std::false_type /* default constructible */) {
+    std::vector<std::vector<ValueType<Iterator>>> partials(views.size());
+    executor.run(views.size(), [&](const std::size_t part) { partials[part].assign(views[part].begin(), views[part].end()); });
+
+    std::vector<ValueType<Iterator>> result;
+    result.reserve(static_cast<std::size_t>(views.back().end() - views.front().begin()));
+    for (std::vector<ValueType<Iterator>>& partial : partials) {
+        std::move(partial.begin(), partial.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+template<class Iterator, class Executor>
+std::vector<ValueType<Iterator>>
+parallelToVector(Iterator begin, Iterator end, const std::size_t parts, Executor& executor, std::true_type /* splittable */) {
+    const std::vector<BasicIteratorView<Iterator>> views = splitRange(begin, end, parts == 0 ? defaultParts() : parts);
+    if (views.size() == 1) {
+        return std::vector<ValueType<Iterator>>(std::move(begin), std::move(end));
+    }
+    return parallelToVector(views, executor,
+                            std::integral_constant<bool, std::is_default_constructible<ValueType<Iterator>>::value &&
+                                                                    std::is_copy_assignable<ValueType<Iterator>>::value>());
+}
+
+template<class Iterator, class Executor>
+std::vector<ValueType<Iterator>>
+parallelToVector(Iterator begin, Iterator end, std::size_t, Executor&, std::false_type /* splittable */) {
+    return std::vector<ValueType<Iterator>>(std::move(begin), std::move(end));
+}
+
+template<class Iterator, class Predicate, class Executor>
+DiffType<Iterator>
+parallelCountIf(Iterator begin, Iterator end, const Predicate& predicate, const std::size_t parts, Executor& executor) {
+    const std::vector<BasicIteratorView<Iterator>> views = splitIfPossible(std::move(begin), std::move(end), parts);
+    std::vector<DiffType<Iterator>> counts(views.size());
+    executor.run(views.size(), [&](const std::size_t part) {
+        Predicate partPredicate = predicate;
+        counts[part] = std::count_if(views[part].begin(), views[part].end(), partPredicate);
+    });
+    return std::accumulate(counts.begin(), counts.end(), DiffType<Iterator>{ 0 });
+}
+
+// The amount of elements per block of `lz::parallelFoldlDeterministic` if no block size is given
+constexpr std::size_t DefaultReductionBlock = 1024;
+
+// Folds every block of `blockSize` elements from `init`. The parts only decide which thread folds which blocks, so the results
+// do not depend on the amount of parts
+template<class Iterator, class T, class Function, class Executor>
+std::vector<T> foldlBlocks(Iterator begin, Iterator end, const T& init, const Function& function, const std::size_t blockSize,
+                           std::size_t parts, Executor& executor, std::true_type /* splittable */) {
+    const auto size = static_cast<std::size_t>(end - begin);
+    const std::size_t blocks = size / blockSize + (size % blockSize == 0 ? 0 : 1);
+    std::vector<T> partials(blocks, init);
+    if (blocks == 0) {
+        return partials;
+    }
+
+    parts = std::min(parts == 0 ? defaultParts() : parts, blocks);
+    executor.run(parts, [&](const std::size_t part) {
+        const std::size_t lastBlock = (part + 1) * blocks / parts;
+        for (std::size_t block = part * blocks / parts; block < lastBlock; ++block) {
+            const Iterator first = begin + static_cast<DiffType<Iterator>>(block * blockSize);
+            const Iterator last = block + 1 == blocks ? end : first + static_cast<DiffType<Iterator>>(blockSize);
+            partials[block] = foldlPart(first, last, std::move(partials[block]), function);
+        }
+    });
+    return partials;
+}
+
+// Views that cannot be split are folded on the calling thread, in the same blocks, so the result is the same as if they could
+template<class Iterator, class T, class Function, class Executor>
+std::vector<T> foldlBlocks(Iterator begin, Iterator end, const T& init, Function function, const std::size_t blockSize,
+                           std::size_t, Executor&, std::false_type /* splittable */) {
+    std::vector<T> partials;
+    while (begin != end) {
+        T result = init;
+        for (std::size_t i = 0; i < blockSize && begin != end; ++i, ++begin) {
+            result = function(std::move(result), *begin);
+        }
+        partials.push_back(std::move(result));
+    }
+    return partials;
+}
+
+// Combines adjacent results pairwise, level by level, so the shape of the tree only depends on the amount of results
+template<class T, class Combine>
+T combineTree(std::vector<T>& partials, Combine& combine) {
+    for (std::size_t stride = 1; stride < partials.size(); stride *= 2) {
+        for (std::size_t i = 0; i + stride < partials.size(); i += 2 * stride) {
+            partials[i] = combine(std::move(partials[i]), std::move(partials[i + stride]));
+        }
+    }
+    return std::move(partials.front());
+}
+
+template<class T>
+struct EqualTo {
+    const T* value;
+
+    template<class U>
+    bool operator()(const U& other) const {
+        return other == *value;
+    }
+};
+
+// Moves output `I` of every part to the end of `output`, in order, after reserving exactly enough room for all of them
+template<std::size_t I, class Container, class Partials>
+void appendParts(Container& output, Partials& partials) {
+    std::size_t size = 0;
+    for (auto& partial : partials) {
+        size += std::get<I>(partial).size();
+    }
+    reserveMore(output, size);
+    for (auto& partial : partials) {
+        for (auto& value : std::get<I>(partial)) {
+            output.insert(output.end(), std::move(value));
+        }
+    }
+}
+
+template<class Iterator, class TrueContainer, class FalseContainer, class Predicate, class Executor>
+void parallelPartitionTo(Iterator begin, Iterator end, TrueContainer& outTrue, FalseContainer& outFalse,
+                         const Predicate& predicate, const std::size_t parts, Executor& executor) {
+    const std::vector<BasicIteratorView<Iterator>> views = splitIfPossible(begin, end, parts);
+    if (views.size() == 1) {
+        internal::partitionTo(std::move(begin), end, outTrue, outFalse, predicate);
+        return;
+    }
+
+    using Partial =
+        std::pair<std::vector<typename TrueContainer::value_type>, std::vector<typename FalseContainer::value_type>>;
+    std::vector<Partial> partials(views.size());
+    executor.run(views.size(), [&](const std::size_t part) {
+        internal::partitionTo(views[part].begin(), views[part].end(), partials[part].first, partials[part].second, predicate);
+    });
+    appendParts<0>(outTrue, partials);
+    appendParts<1>(outFalse, partials);
+}
+
+template<class Iterator, class... Containers, class Executor, std::size_t... I>
+void parallelUnzipTo(Iterator begin, Iterator end, std::tuple<Containers&...>& outputs, const std::size_t parts,
+                     Executor& executor, IndexSequence<I...> indices) {
+    const std::vector<BasicIteratorView<Iterator>> views = splitIfPossible(begin, end, parts);
+    if (views.size() == 1) {
+        internal::unzipTo(std::move(begin), end, outputs, indices);
+        return;
+    }
+
+    std::vector<std::tuple<std::vector<typename Containers::value_type>...>> partials(views.size());
+    executor.run(views.size(), [&](const std::size_t part) {
+        internal::unzipTo(views[part].begin(), views[part].end(), partials[part], indices);
+    });
+    const int expand[] = { 0, (appendParts<I>(std::get<I>(outputs), partials), 0)... };
+    static_cast<void>(expand);
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Splits a view into at most `parts` sub views of (almost) equal size, that can be processed independently, i.e. on
+ * different threads. Only views of which the position of any element can be computed without evaluating the elements before it
+ * can be split, which are the views with random access iterators. Chains of i.e. `lz::range`, `lz::map`, `lz::zip`,
+ * `lz::enumerate`, `lz::takeEvery`, `lz::chunks`, `lz::cartesian` and `lz::concat` over random access containers can all be
+ * split.
+ * @param iterable The view to split.
+ * @param parts The amount of parts. Less parts are returned if the view contains less elements. An empty view results in one
+ * empty part.
+ * @return A vector of sub views, in order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<internal::BasicIteratorView<internal::IterTypeFromIterable<Iterable>>>
+splitInto(Iterable&& iterable, const std::size_t parts) {
+    return internal::splitRange(internal::begin(std::forward<Iterable>(iterable)),
+                                internal::end(std::forward<Iterable>(iterable)), parts);
+}
+
+/**
+ * @brief Calls `function` for every element of `iterable`, where the view is split into parts that are processed by the
+ * executor. Every part uses its own copy of `function`, but the parts run concurrently, so any state that is shared between the
+ * copies must be thread safe. Views that cannot be split (see `lz::splitInto`) are processed on the calling thread, so that
+ * `function` gets the elements themselves; use `lz::parallelForEachChunked` to process copies of their elements in parallel.
+ * The first exception that is thrown by `function` is rethrown after all parts have finished.
+ * @param iterable The view to iterate over.
+ * @param function The function to call with every element.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function, class Executor = ThreadPool>
+void parallelForEach(Iterable&& iterable, const Function& function, const std::size_t parts = 0,
+                     Executor& executor = ThreadPool::global()) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    internal::parallelForEach(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              function, parts, executor, internal::IsSplittable<Iterator>());
+}
+
+/**
+ * @brief Calls `function` for every element of `iterable`, where the calling thread copies chunks of `grain` elements from the
+ * view, that are processed by the workers of `pool`. This works for any view, including views that cannot be split (i.e.
+ * `lz::filter` or `lz::flatten`), and pays off if `function` is expensive compared to iterating the view. Every chunk uses its
+ * own copy of `function`, but the chunks run concurrently, so any state that is shared between the copies must be thread safe.
+ * The first exception that is thrown by `function` is rethrown after all chunks that are in flight have finished.
+ * @param iterable The view to iterate over.
+ * @param function The function to call with every element.
+ * @param grain The amount of elements per chunk. Defaults to 128.
+ * @param maxInFlight The maximum amount of chunks that are buffered or being processed at the same time, which bounds the
+ * memory that is used. Defaults to twice the amount of threads of `pool`.
+ * @param pool The thread pool that processes the chunks. Defaults to `lz::ThreadPool::global()`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function>
+void parallelForEachChunked(Iterable&& iterable, const Function& function, const std::size_t grain = 0,
+                            const std::size_t maxInFlight = 0, ThreadPool& pool = ThreadPool::global()) {
+    internal::parallelForEachChunked(internal::begin(std::forward<Iterable>(iterable)),
+                                     internal::end(std::forward<Iterable>(iterable)), function, grain, maxInFlight, pool);
+}
+
+/**
+ * @brief Folds every part of a split view (see `lz::splitInto`) from `init` in parallel, after which the results of the
+ * parts are combined from left to right using `combine`. Because every part starts from `init`, `init` must be an identity of
+ * `combine` (i.e. `0` for addition). Views that cannot be split are folded on the calling thread.
+ * @param iterable The view to fold.
+ * @param init The starting value of every part.
+ * @param function Folds an element into the result of a part, i.e. `[](T acc, const U& value) { return acc + value; }`.
+ * @param combine Combines the results of two parts, i.e. `[](T a, T b) { return a + b; }`.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The folded value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Function, class Combine, class Executor = ThreadPool>
+LZ_NODISCARD internal::EnableIf<!std::is_integral<Combine>::value, T>
+parallelFoldl(Iterable&& iterable, const T& init, const Function& function, Combine combine, const std::size_t parts = 0,
+              Executor& executor = ThreadPool::global()) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    const std::vector<internal::BasicIteratorView<Iterator>> views = internal::splitIfPossible(
+        internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), parts);
+    std::vector<T> partials(views.size(), init);
+    executor.run(views.size(), [&](const std::size_t part) {
+        partials[part] = internal::foldlPart(views[part].begin(), views[part].end(), std::move(partials[part]), function);
+    });
+
+    T result = std::move(partials.front());
+    for (std::size_t part = 1; part < partials.size(); ++part) {
+        result = combine(std::move(result), std::move(partials[part]));
+    }
+    return result;
+}
+
+/**
+ * @brief Folds every part of a split view (see `lz::splitInto`) from `init` in parallel, after which the results of the
+ * parts are combined from left to right using `function` as well. Because every part starts from `init`, `init` must be an
+ * identity of `function` (i.e. `0` for addition). Views that cannot be split are folded on the calling thread.
+ * @param iterable The view to fold.
+ * @param init The starting value of every part.
+ * @param function Folds an element, or the result of another part, into the result of a part.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The folded value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Function, class Executor = ThreadPool>
+LZ_NODISCARD T parallelFoldl(Iterable&& iterable, const T& init, const Function& function, const std::size_t parts = 0,
+                             Executor& executor = ThreadPool::global()) {
+    return lz::parallelFoldl(std::forward<Iterable>(iterable), init, function, function, parts, executor);
+}
+
+/**
+ * @brief Folds a view in parallel, with a result that does not depend on the amount of parts, the executor or the scheduling, so
+ * that i.e. floating point sums are bit-identical between runs and machines. The view is divided into blocks of `blockSize`
+ * elements, that are folded from `init` from left to right. The blocks are distributed over the parts, and their results are
+ * combined by a balanced tree of `combine` calls, of which the shape only depends on the amount of blocks. Because every block
+ * starts from `init`, `init` must be an identity of `combine` (i.e. `0` for addition). Views that cannot be split are folded on
+ * the calling thread, in the same blocks, so their result is the same as well.
+ * @param iterable The view to fold.
+ * @param init The starting value of every block.
+ * @param function Folds an element into the result of a block, i.e. `[](T acc, const U& value) { return acc + value; }`.
+ * @param combine Combines the results of two blocks, i.e. `[](T a, T b) { return a + b; }`.
+ * @param blockSize The amount of elements per block. The result depends on it. Defaults to 1024.
+ * @param parts The amount of parts to divide the blocks over. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The folded value, or `init` if the view is empty.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Function, class Combine, class Executor = ThreadPool>
+LZ_NODISCARD internal::EnableIf<!std::is_integral<Combine>::value, T>
+parallelFoldlDeterministic(Iterable&& iterable, const T& init, const Function& function, Combine combine,
+                           const std::size_t blockSize = 0, const std::size_t parts = 0,
+                           Executor& executor = ThreadPool::global()) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    std::vector<T> partials =
+        internal::foldlBlocks(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              init, function, blockSize == 0 ? internal::DefaultReductionBlock : blockSize, parts, executor,
+                              internal::IsSplittable<Iterator>());
+    if (partials.empty()) {
+        return init;
+    }
+    return internal::combineTree(partials, combine);
+}
+
+/**
+ * @brief Folds a view in parallel, with a result that does not depend on the amount of parts, the executor or the scheduling.
+ * The results of the blocks are combined using `function` as well. See `lz::parallelFoldlDeterministic` for details.
+ * @param iterable The view to fold.
+ * @param init The starting value of every block.
+ * @param function Folds an element, or the result of another block, into the result of a block.
+ * @param blockSize The amount of elements per block. The result depends on it. Defaults to 1024.
+ * @param parts The amount of parts to divide the blocks over. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The folded value, or `init` if the view is empty.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Function, class Executor = ThreadPool>
+LZ_NODISCARD T parallelFoldlDeterministic(Iterable&& iterable, const T& init, const Function& function,
+                                          const std::size_t blockSize = 0, const std::size_t parts = 0,
+                                          Executor& executor = ThreadPool::global()) {
+    return lz::parallelFoldlDeterministic(std::forward<Iterable>(iterable), init, function, function, blockSize, parts, executor);
+}
+
+/**
+ * @brief Sums a view in parallel, with a result that does not depend on the amount of parts, the executor or the scheduling, so
+ * that floating point sums are bit-identical between runs and machines. See `lz::parallelFoldlDeterministic` for details.
+ * @param iterable The view to sum.
+ * @param blockSize The amount of elements per block. The result depends on it. Defaults to 1024.
+ * @param parts The amount of parts to divide the blocks over. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The sum of the elements, or a value initialized value type if the view is empty.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Executor = ThreadPool, class T = internal::ValueTypeIterable<Iterable>>
+LZ_NODISCARD T parallelSumDeterministic(Iterable&& iterable, const std::size_t blockSize = 0, const std::size_t parts = 0,
+                                        Executor& executor = ThreadPool::global()) {
+    return lz::parallelFoldlDeterministic(std::forward<Iterable>(iterable), T(), MAKE_BIN_OP(std::plus, T)(), blockSize, parts,
+                                          executor);
+}
+
+/**
+ * @brief Evaluates a view into a vector, where the view is split into parts (see `lz::splitInto`) that are evaluated in
+ * parallel. If the value type is default constructible, every part writes directly to its own slice of the vector, otherwise
+ * the parts are concatenated afterwards. Views that cannot be split are evaluated on the calling thread.
+ * @param iterable The view to evaluate.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return A vector containing the elements of the view, in order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Executor = ThreadPool>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+parallelToVector(Iterable&& iterable, const std::size_t parts = 0, Executor& executor = ThreadPool::global()) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    return internal::parallelToVector(internal::begin(std::forward<Iterable>(iterable)),
+                                      internal::end(std::forward<Iterable>(iterable)), parts, executor,
+                                      internal::IsSplittable<Iterator>());
+}
+
+/**
+ * @brief Counts the elements for which `predicate` returns true, where the view is split into parts (see `lz::splitInto`) that
+ * are counted in parallel. Every part uses its own copy of `predicate`. Views that cannot be split are counted on the
+ * calling thread.
+ * @param iterable The view to count the elements of.
+ * @param predicate The predicate that must return a bool.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The amount of elements for which `predicate` returned true.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class UnaryPredicate, class Executor = ThreadPool>
+LZ_NODISCARD internal::DiffType<internal::IterTypeFromIterable<Iterable>>
+parallelCountIf(Iterable&& iterable, const UnaryPredicate& predicate, const std::size_t parts = 0,
+                Executor& executor = ThreadPool::global()) {
+    return internal::parallelCountIf(internal::begin(std::forward<Iterable>(iterable)),
+                                     internal::end(std::forward<Iterable>(iterable)), predicate, parts, executor);
+}
+
+/**
+ * @brief Counts the elements that are equal to `value`, where the view is split into parts (see `lz::splitInto`) that are
+ * counted in parallel. Views that cannot be split are counted on the calling thread.
+ * @param iterable The view to count the elements of.
+ * @param value The value to count.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ * @return The amount of elements that are equal to `value`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class Executor = ThreadPool>
+LZ_NODISCARD internal::DiffType<internal::IterTypeFromIterable<Iterable>>
+parallelCount(Iterable&& iterable, const T& value, const std::size_t parts = 0, Executor& executor = ThreadPool::global()) {
+    return lz::parallelCountIf(std::forward<Iterable>(iterable), internal::EqualTo<T>{ std::addressof(value) }, parts, executor);
+}
+
+/**
+ * @brief Splits a view into the elements for which `predicate` returns true and the elements for which it returns false (see
+ * `lz::partitionTo`), where the view is split into parts (see `lz::splitInto`) that are partitioned in parallel. The parts are
+ * appended to the containers in order, after every container has reserved exactly enough room for them. Every part uses its own
+ * copy of `predicate`. Views that cannot be split are partitioned on the calling thread.
+ * @param iterable The view to partition.
+ * @param outTrue The container to append the elements to for which `predicate` returns true.
+ * @param outFalse The container to append the elements to for which `predicate` returns false.
+ * @param predicate The predicate that must return a bool.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class TrueContainer, class FalseContainer, class UnaryPredicate,
+         class Executor = ThreadPool>
+void parallelPartitionTo(Iterable&& iterable, TrueContainer& outTrue, FalseContainer& outFalse, const UnaryPredicate& predicate,
+                         const std::size_t parts = 0, Executor& executor = ThreadPool::global()) {
+    internal::parallelPartitionTo(internal::begin(std::forward<Iterable>(iterable)),
+                                  internal::end(std::forward<Iterable>(iterable)), outTrue, outFalse, predicate, parts, executor);
+}
+
+/**
+ * @brief Appends every member of every element to its own container (see `lz::unzipTo`), where the view is split into parts
+ * (see `lz::splitInto`) that are unzipped in parallel. The parts are appended to the containers in order, after every container
+ * has reserved exactly enough room for them. Views that cannot be split are unzipped on the calling thread.
+ * @param iterable The view of tuple-like elements to unzip.
+ * @param outputs The containers to append the members to, i.e. `std::tie(outNames, outAges)`.
+ * @param parts The amount of parts to split the view in. Defaults to the amount of hardware threads.
+ * @param executor The executor that runs the parts, see `lz::ThreadPool`. Defaults to `lz::ThreadPool::global()`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class... Containers, class Executor = ThreadPool>
+void parallelUnzipTo(Iterable&& iterable, std::tuple<Containers&...> outputs, const std::size_t parts = 0,
+                     Executor& executor = ThreadPool::global()) {
+    internal::parallelUnzipTo(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              outputs, parts, executor, internal::MakeIndexSequence<sizeof...(Containers)>());
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_PARALLEL_HPP
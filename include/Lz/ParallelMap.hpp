@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_HPP
+#    define LZ_PARALLEL_MAP_HPP
+
+#    include "ThreadPool.hpp"
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ParallelMapIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Function, bool Ordered>
+class ParallelMap final
+    : public internal::BasicIteratorView<internal::ParallelMapIterator<Iterator, Function, ThreadPool, Ordered>> {
+    using Pipeline = internal::ParallelMapPipeline<Iterator, Function, ThreadPool, Ordered>;
+
+public:
+    using iterator = internal::ParallelMapIterator<Iterator, Function, ThreadPool, Ordered>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    ParallelMap(Iterator begin, Iterator end, Function function, const std::size_t window, ThreadPool& pool) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<Pipeline>(std::move(begin), std::move(end), std::move(function), pool, window)),
+            iterator()) {
+    }
+
+    ParallelMap() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns an input iterator that maps the elements of the sequence on the workers of a thread pool, while the results are
+ * iterated over in the order of the sequence. This is useful if `function` is expensive (i.e. parsing, hashing or
+ * (de)compressing) and the results are consumed by a sequential stage, or if the sequence cannot be split (see
+ * `lz::parallelForEach`).
+ * @details The sequence is iterated over by the thread that iterates over the result. At most `window` elements are being
+ * mapped, or have been mapped but have not been iterated over yet, at any time. If the result of the first element of the window
+ * is not ready yet, the consuming thread runs tasks of the pool until it is. If `function` throws, the exception is rethrown
+ * when the result of that element is reached. The elements are copied to the tasks, and `function` is called concurrently, so it
+ * must be safe to call from multiple threads. The iterators share their state, so the sequence can only be iterated over once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function A function that takes a value type as parameter. It may return anything that is copy or move constructible.
+ * @param window The maximum amount of elements that are mapped ahead. Defaults to two times the amount of threads of the pool.
+ * @param pool The thread pool that maps the elements.
+ * @return A ParallelMap object from [begin, end) that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD ParallelMap<Iterator, Function, true>
+parallelMapRange(Iterator begin, Iterator end, Function function, const std::size_t window = 0,
+                 ThreadPool& pool = ThreadPool::global()) {
+    return { std::move(begin), std::move(end), std::move(function), window, pool };
+}
+
+/**
+ * @brief Returns an input iterator that maps the elements of the sequence on the workers of a thread pool, while the results are
+ * iterated over in the order of the sequence. See `lz::parallelMapRange` for details.
+ * @param iterable The sequence to map.
+ * @param function A function that takes a value type as parameter. It may return anything that is copy or move constructible.
+ * @param window The maximum amount of elements that are mapped ahead. Defaults to two times the amount of threads of the pool.
+ * @param pool The thread pool that maps the elements.
+ * @return A ParallelMap object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD ParallelMap<internal::IterTypeFromIterable<Iterable>, internal::Decay<Function>, true>
+parallelMap(Iterable&& iterable, Function&& function, const std::size_t window = 0, ThreadPool& pool = ThreadPool::global()) {
+    return parallelMapRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            std::forward<Function>(function), window, pool);
+}
+
+/**
+ * @brief Returns an input iterator that maps the elements of the sequence on the workers of a thread pool, and yields the results
+ * in the order in which they are finished. It behaves like `lz::parallelMapRange`, except that a slow element does not hold back
+ * the results of the elements after it, which makes it the better choice if the order of the results does not matter.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function A function that takes a value type as parameter. It may return anything that is copy or move constructible.
+ * @param window The maximum amount of elements that are mapped ahead. Defaults to two times the amount of threads of the pool.
+ * @param pool The thread pool that maps the elements.
+ * @return A ParallelMap object from [begin, end) that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD ParallelMap<Iterator, Function, false>
+parallelMapUnorderedRange(Iterator begin, Iterator end, Function function, const std::size_t window = 0,
+                          ThreadPool& pool = ThreadPool::global()) {
+    return { std::move(begin), std::move(end), std::move(function), window, pool };
+}
+
+/**
+ * @brief Returns an input iterator that maps the elements of the sequence on the workers of a thread pool, and yields the results
+ * in the order in which they are finished. See `lz::parallelMapUnorderedRange` for details.
+ * @param iterable The sequence to map.
+ * @param function A function that takes a value type as parameter. It may return anything that is copy or move constructible.
+ * @param window The maximum amount of elements that are mapped ahead. Defaults to two times the amount of threads of the pool.
+ * @param pool The thread pool that maps the elements.
+ * @return A ParallelMap object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD ParallelMap<internal::IterTypeFromIterable<Iterable>, internal::Decay<Function>, false>
+parallelMapUnordered(Iterable&& iterable, Function&& function, const std::size_t window = 0,
+                     ThreadPool& pool = ThreadPool::global()) {
+    return parallelMapUnorderedRange(internal::begin(std::forward<Iterable>(iterable)),
+                                     internal::end(std::forward<Iterable>(iterable)), std::forward<Function>(function), window,
+                                     pool);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_HPP
@@ -0,0 +1,404 @@
+#pragma once
+
+#ifndef LZ_QUANTILES_HPP
+#    define LZ_QUANTILES_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <algorithm>
+#    include <cmath>
+#    include <random>
+#    include <utility>
+#    include <vector>
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <execution>
+#    endif // LZ_HAS_EXECUTION
+
+namespace lz {
+namespace internal {
+// Returns the indices of `probabilities`, ordered by probability
+inline std::vector<std::size_t> sortedIndices(const std::vector<double>& probabilities) {
+    std::vector<std::size_t> order(probabilities.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        LZ_ASSERT(probabilities[i] >= 0. && probabilities[i] <= 1., "probabilities must be between 0 and 1");
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(),
+              [&probabilities](const std::size_t a, const std::size_t b) { return probabilities[a] < probabilities[b]; });
+    return order;
+}
+
+// Calculates the quantiles of `buffer`, interpolating linearly between the two closest ranks. Because the probabilities are
+// handled in ascending order, every selection only has to partition the elements that are not selected yet.
+template<class T, class SelectFn, class MinFn>
+std::vector<double>
+selectQuantiles(std::vector<T>& buffer, const std::vector<double>& probabilities, SelectFn select, MinFn minElement) {
+    LZ_ASSERT(!buffer.empty(), "sequence cannot be empty in order to get quantiles");
+    using Iterator = typename std::vector<T>::iterator;
+    using Diff = typename std::vector<T>::difference_type;
+
+    std::vector<double> result(probabilities.size());
+    Iterator first = buffer.begin();
+    const Iterator end = buffer.end();
+
+    for (const std::size_t index : sortedIndices(probabilities)) {
+        const double position = probabilities[index] * static_cast<double>(buffer.size() - 1);
+        const double lower = std::floor(position);
+        const Iterator nth = buffer.begin() + static_cast<Diff>(lower);
+        select(first, nth, end);
+        first = nth;
+
+        const auto low = static_cast<double>(*nth);
+        const double fraction = position - lower;
+        if (fraction == 0. || nth + 1 == end) {
+            result[index] = low;
+        }
+        else {
+            const auto high = static_cast<double>(*minElement(nth + 1, end));
+            result[index] = low + fraction * (high - low);
+        }
+    }
+    return result;
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * A KLL sketch (Karnin, Lang & Liberty) that estimates quantiles of a stream of values using bounded memory. The sketch retains
+ * roughly `3 * k` values, regardless of the amount of values added. Larger `k` gives more accurate results; the rank error is
+ * approximately `1.7 / k`. Two sketches over different parts of a sequence can be merged, which makes it suitable for
+ * accumulating partitions in parallel. `T` must be copyable and comparable using `operator<`.
+ */
+template<class T>
+class KllSketch {
+    // Level `h` contains values with a weight of 2^h
+    std::vector<std::vector<T>> _compactors{};
+    std::size_t _k{};
+    std::size_t _count{};
+    std::size_t _retained{};
+    std::size_t _maxRetained{};
+    std::minstd_rand _random{};
+
+    std::size_t capacity(const std::size_t level) const {
+        const auto depth = static_cast<double>(_compactors.size() - level - 1);
+        return static_cast<std::size_t>(std::ceil(std::pow(2. / 3., depth) * static_cast<double>(_k))) + 1;
+    }
+
+    void grow() {
+        _compactors.emplace_back();
+        _maxRetained = 0;
+        for (std::size_t level = 0; level < _compactors.size(); ++level) {
+            _maxRetained += capacity(level);
+        }
+    }
+
+    // Sorts the level and moves every other value (with a random offset) to the next level, doubling their weight. If the
+    // level has an odd amount of values, the largest one stays behind
+    void compact(const std::size_t level) {
+        std::vector<T>& values = _compactors[level];
+        std::vector<T>& next = _compactors[level + 1];
+        std::sort(values.begin(), values.end());
+
+        const std::size_t even = values.size() - values.size() % 2;
+        for (std::size_t i = _random() % 2; i < even; i += 2) {
+            next.push_back(std::move(values[i]));
+        }
+        values.erase(values.begin(), values.begin() + static_cast<typename std::vector<T>::difference_type>(even));
+    }
+
+    void updateRetained() {
+        _retained = 0;
+        for (const std::vector<T>& values : _compactors) {
+            _retained += values.size();
+        }
+    }
+
+    void compress() {
+        for (std::size_t level = 0; level < _compactors.size(); ++level) {
+            if (_compactors[level].size() < capacity(level)) {
+                continue;
+            }
+            if (level + 1 == _compactors.size()) {
+                grow();
+            }
+            compact(level);
+            updateRetained();
+            if (_retained < _maxRetained) {
+                break;
+            }
+        }
+    }
+
+    std::vector<std::pair<T, std::size_t>> weightedValues() const {
+        std::vector<std::pair<T, std::size_t>> weighted;
+        weighted.reserve(_retained);
+        for (std::size_t level = 0; level < _compactors.size(); ++level) {
+            for (const T& value : _compactors[level]) {
+                weighted.emplace_back(value, std::size_t{ 1 } << level);
+            }
+        }
+        std::sort(weighted.begin(), weighted.end(),
+                  [](const std::pair<T, std::size_t>& a, const std::pair<T, std::size_t>& b) { return a.first < b.first; });
+        return weighted;
+    }
+
+public:
+    using value_type = T;
+
+    /**
+     * Creates an empty sketch.
+     * @param k The accuracy parameter. The sketch retains roughly `3 * k` values.
+     * @param seed The seed for choosing which values are retained when compacting.
+     */
+    explicit KllSketch(const std::size_t k = 200, const unsigned seed = std::minstd_rand::default_seed) :
+        _k(k),
+        _random(seed) {
+        LZ_ASSERT(k >= 2, "k must be at least 2");
+        grow();
+    }
+
+    /**
+     * Adds a value to the sketch.
+     * @param value The value to add.
+     * @return A reference to this sketch.
+     */
+    KllSketch& add(T value) {
+        _compactors.front().push_back(std::move(value));
+        ++_count;
+        ++_retained;
+        if (_retained >= _maxRetained) {
+            compress();
+        }
+        return *this;
+    }
+
+    /**
+     * Merges the values of another sketch into this one.
+     * @param other The sketch to merge.
+     * @return A reference to this sketch.
+     */
+    KllSketch& merge(const KllSketch& other) {
+        while (_compactors.size() < other._compactors.size()) {
+            grow();
+        }
+        for (std::size_t level = 0; level < other._compactors.size(); ++level) {
+            const std::vector<T>& values = other._compactors[level];
+            _compactors[level].insert(_compactors[level].end(), values.begin(), values.end());
+        }
+        _count += other._count;
+        updateRetained();
+        while (_retained >= _maxRetained) {
+            compress();
+        }
+        return *this;
+    }
+
+    //! Returns the amount of values added.
+    LZ_NODISCARD std::size_t count() const noexcept {
+        return _count;
+    }
+
+    //! Returns true if no values are added, false otherwise.
+    LZ_NODISCARD bool empty() const noexcept {
+        return _count == 0;
+    }
+
+    //! Returns the amount of values that are currently stored in the sketch.
+    LZ_NODISCARD std::size_t retained() const noexcept {
+        return _retained;
+    }
+
+    /**
+     * Estimates the value at `probability`. The sketch cannot be empty.
+     * @param probability The probability, between 0 and 1. I.e. 0.5 gives the (approximate) median.
+     * @return The estimated value.
+     */
+    LZ_NODISCARD T quantile(const double probability) const {
+        return quantiles({ probability }).front();
+    }
+
+    /**
+     * Estimates the values at `probabilities`. The sketch cannot be empty.
+     * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+     * @return The estimated values, in the same order as `probabilities`.
+     */
+    LZ_NODISCARD std::vector<T> quantiles(const std::vector<double>& probabilities) const {
+        LZ_ASSERT(_count != 0, "sketch cannot be empty in order to get quantiles");
+        const std::vector<std::pair<T, std::size_t>> weighted = weightedValues();
+        std::vector<T> result;
+        result.reserve(probabilities.size());
+
+        for (const double probability : probabilities) {
+            LZ_ASSERT(probability >= 0. && probability <= 1., "probabilities must be between 0 and 1");
+            const double target = probability * static_cast<double>(_count);
+            std::size_t cumulative = 0;
+            auto it = weighted.begin();
+            for (; it != weighted.end() - 1; ++it) {
+                cumulative += it->second;
+                if (static_cast<double>(cumulative) >= target) {
+                    break;
+                }
+            }
+            result.push_back(it->first);
+        }
+        return result;
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Adds all values of a sequence to a `lz::KllSketch`. The sequence is not modified, and may be any (lazy) input sequence.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The accuracy parameter. The sketch retains roughly `3 * k` values.
+ * @return A `lz::KllSketch` containing the values of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD KllSketch<internal::ValueType<Iterator>> kllSketch(Iterator begin, Iterator end, const std::size_t k = 200) {
+    KllSketch<internal::ValueType<Iterator>> sketch(k);
+    for (; begin != end; ++begin) {
+        sketch.add(*begin);
+    }
+    return sketch;
+}
+
+/**
+ * Adds all values of a sequence to a `lz::KllSketch`. The sequence is not modified, and may be any (lazy) input sequence.
+ * @param iterable The sequence to add.
+ * @param k The accuracy parameter. The sketch retains roughly `3 * k` values.
+ * @return A `lz::KllSketch` containing the values of the sequence.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD KllSketch<internal::ValueTypeIterable<Iterable>> kllSketch(const Iterable& iterable, const std::size_t k = 200) {
+    return lz::kllSketch(std::begin(iterable), std::end(iterable), k);
+}
+
+/**
+ * Estimates the quantiles of a sequence in a single pass using bounded memory, using a `lz::KllSketch`. The sequence is not
+ * modified, and may be any (lazy) input sequence. The sequence cannot be empty.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @param k The accuracy parameter. The sketch retains roughly `3 * k` values.
+ * @return The estimated values, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+approxQuantiles(Iterator begin, Iterator end, const std::vector<double>& probabilities, const std::size_t k = 200) {
+    return lz::kllSketch(std::move(begin), std::move(end), k).quantiles(probabilities);
+}
+
+/**
+ * Estimates the quantiles of a sequence in a single pass using bounded memory, using a `lz::KllSketch`. The sequence is not
+ * modified, and may be any (lazy) input sequence. The sequence cannot be empty.
+ * @param iterable The sequence to get the quantiles of.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @param k The accuracy parameter. The sketch retains roughly `3 * k` values.
+ * @return The estimated values, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+approxQuantiles(const Iterable& iterable, const std::vector<double>& probabilities, const std::size_t k = 200) {
+    return lz::approxQuantiles(std::begin(iterable), std::end(iterable), probabilities, k);
+}
+
+#    ifdef LZ_HAS_EXECUTION
+/**
+ * Gets the exact quantiles of a sequence, interpolating linearly between the two closest values (like `lz::median`). Unlike
+ * `lz::median`, the sequence is copied into a scratch buffer first, so that it is not reordered and can be any (lazy) input
+ * sequence. The sequence cannot be empty.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @param execution The execution policy, used for selecting the values. Must be one of `std::execution`'s tags.
+ * @return The quantiles, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<double>
+quantiles(Iterator begin, Iterator end, const std::vector<double>& probabilities, Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    using BufferIterator = typename std::vector<ValueType>::iterator;
+    std::vector<ValueType> buffer(std::move(begin), std::move(end));
+
+    if constexpr (internal::IsSequencedPolicyV<Execution>) {
+        static_cast<void>(execution);
+        return internal::selectQuantiles(
+            buffer, probabilities,
+            [](BufferIterator first, BufferIterator nth, BufferIterator last) { std::nth_element(first, nth, last); },
+            [](BufferIterator first, BufferIterator last) { return std::min_element(first, last); });
+    }
+    else {
+        return internal::selectQuantiles(
+            buffer, probabilities,
+            [execution](BufferIterator first, BufferIterator nth, BufferIterator last) {
+                std::nth_element(execution, first, nth, last);
+            },
+            [execution](BufferIterator first, BufferIterator last) { return std::min_element(execution, first, last); });
+    }
+}
+
+/**
+ * Gets the exact quantiles of a sequence, interpolating linearly between the two closest values (like `lz::median`). Unlike
+ * `lz::median`, the sequence is copied into a scratch buffer first, so that it is not reordered and can be any (lazy) input
+ * sequence. The sequence cannot be empty.
+ * @param iterable The sequence to get the quantiles of.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @param execution The execution policy, used for selecting the values. Must be one of `std::execution`'s tags.
+ * @return The quantiles, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<double>
+quantiles(const Iterable& iterable, const std::vector<double>& probabilities, Execution execution = std::execution::seq) {
+    return lz::quantiles(std::begin(iterable), std::end(iterable), probabilities, execution);
+}
+#    else
+/**
+ * Gets the exact quantiles of a sequence, interpolating linearly between the two closest values (like `lz::median`). Unlike
+ * `lz::median`, the sequence is copied into a scratch buffer first, so that it is not reordered and can be any (lazy) input
+ * sequence. The sequence cannot be empty.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @return The quantiles, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD std::vector<double> quantiles(Iterator begin, Iterator end, const std::vector<double>& probabilities) {
+    using ValueType = internal::ValueType<Iterator>;
+    using BufferIterator = typename std::vector<ValueType>::iterator;
+    std::vector<ValueType> buffer(std::move(begin), std::move(end));
+    return internal::selectQuantiles(
+        buffer, probabilities,
+        [](BufferIterator first, BufferIterator nth, BufferIterator last) { std::nth_element(first, nth, last); },
+        [](BufferIterator first, BufferIterator last) { return std::min_element(first, last); });
+}
+
+/**
+ * Gets the exact quantiles of a sequence, interpolating linearly between the two closest values (like `lz::median`). Unlike
+ * `lz::median`, the sequence is copied into a scratch buffer first, so that it is not reordered and can be any (lazy) input
+ * sequence. The sequence cannot be empty.
+ * @param iterable The sequence to get the quantiles of.
+ * @param probabilities The probabilities, between 0 and 1. I.e. `{ 0.5, 0.9, 0.99 }`.
+ * @return The quantiles, in the same order as `probabilities`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<double> quantiles(const Iterable& iterable, const std::vector<double>& probabilities) {
+    return lz::quantiles(std::begin(iterable), std::end(iterable), probabilities);
+}
+#    endif // LZ_HAS_EXECUTION
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_QUANTILES_HPP
@@ -112,11 +112,43 @@ public:
     }
 };
 
-inline std::mt19937 createMtEngine() {
+template<class Engine>
+Engine createEngine() {
     std::random_device rd;
     SeedSequence<8> seedSeq(rd);
-    return std::mt19937(seedSeq);
+    return Engine(seedSeq);
 }
+
+// A stateless generator that forwards to an engine that is local to the calling thread, so that a view that uses it can be
+// iterated from several threads at once, regardless of the thread that created it. Every thread seeds its own engine on first
+// use
+template<class Engine>
+class ThreadLocalEngine {
+public:
+    using result_type = typename Engine::result_type;
+
+    static constexpr result_type(min)() {
+        return (Engine::min)();
+    }
+
+    static constexpr result_type(max)() {
+        return (Engine::max)();
+    }
+
+    result_type operator()() const {
+        return engine()();
+    }
+
+    static Engine& engine() {
+        static thread_local Engine engine = createEngine<Engine>();
+        return engine;
+    }
+
+    static ThreadLocalEngine& instance() {
+        static ThreadLocalEngine instance;
+        return instance;
+    }
+};
 } // namespace internal
 
 LZ_MODULE_EXPORT_SCOPE_BEGIN
@@ -135,6 +167,20 @@ public:
 
     Random() = default;
 
+    /**
+     * Returns a copy of this view, with the same distribution and amount, that draws from `generator` instead. Iterating over
+     * one view from several threads at once is only safe if its generator is, so this can be used to give every thread its own
+     * generator. Views that are created by `lz::random(min, max)` or `lz::threadLocalRandom` already use a generator per thread.
+     * @param generator The generator to draw from.
+     * @return A random view object that draws from `generator`.
+     */
+    LZ_NODISCARD Random clone(Generator& generator) const {
+        Random copy;
+        copy._begin = iterator(this->_begin, generator);
+        copy._end = iterator(this->_end, generator);
+        return copy;
+    }
+
     /**
      * Creates a new random number, not taking into account its size. This is for pure convenience. Example:
      * ```cpp
@@ -172,7 +218,10 @@ public:
  */
 
 /**
- * Creates a random number generator with specified generator and distribution.
+ * Creates a random number generator with specified generator and distribution. Every iterator uses its own copy of
+ * `distribution`, but all of them share `generator`, so the view can only be iterated over from several threads at once if
+ * `generator` is thread safe. Use `Random::clone` or `lz::threadLocalRandom` otherwise. The parallel functions never split the
+ * view, so they iterate over it on one thread.
  * @param distribution A number distribution, for e.g. std::uniform_<type>_distribution<type>.
  * @param generator A random number generator, for e.g. std::mt19937.
  * @param amount The amount of numbers to create.
@@ -185,12 +234,29 @@ random(const Distribution& distribution, Generator& generator,
     return { distribution, generator, static_cast<std::ptrdiff_t>(amount), amount == (std::numeric_limits<std::size_t>::max)() };
 }
 
+/**
+ * Creates a random number generator with specified distribution, that draws from a `Engine` that is local to the thread that
+ * iterates over it. Unlike `lz::random(distribution, generator)`, the view can therefore be iterated over from several threads
+ * at once. Every thread seeds its own engine with a seed sequence of 8 x `std::random_device` on first use.
+ * @tparam Engine The random number engine. `std::mt19937` by default.
+ * @param distribution A number distribution, for e.g. std::uniform_<type>_distribution<type>.
+ * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<std::size_t>::max()`
+ * it is interpreted as a `while-true` loop.
+ * @return A random view object that generates a sequence of `Distribution::result_type`
+ */
+template<class Engine = std::mt19937, class Distribution>
+LZ_NODISCARD Random<typename Distribution::result_type, Distribution, internal::ThreadLocalEngine<Engine>>
+threadLocalRandom(const Distribution& distribution, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+    return random(distribution, internal::ThreadLocalEngine<Engine>::instance(), amount);
+}
+
 #    ifdef __cpp_if_constexpr
 /**
  * @brief Returns an iterator view object that generates a sequence of random numbers, using an uniform distribution.
  * @details This random access iterator view object can be used to generate a sequence of random numbers between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence of 8 x `std::random_device` as seed. The
- * seed sequence is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
+ * [`min, max`]. It uses a std::mt19937 random engine per thread (see `lz::threadLocalRandom`), so the view can be iterated
+ * over from several threads at once. Every engine is seeded with a seed sequence of 8 x `std::random_device`. The seed sequence
+ * is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
  * tends to be more faster than its `std::seed_seq` implementation.
  * @param min The minimum value, included.
  * @param max The maximum value, included.
@@ -206,22 +272,20 @@ random(const Arithmetic min, const Arithmetic max, const std::size_t amount = (s
 #        ifndef LZ_HAS_CONCEPTS
     static_assert(std::is_arithmetic_v<Arithmetic>, "min/max type should be arithmetic");
 #        endif // LZ_HAS_CONCEPTS
-    static std::mt19937 gen = internal::createMtEngine();
     if constexpr (std::is_integral_v<Arithmetic>) {
-        std::uniform_int_distribution<Arithmetic> dist(min, max);
-        return random(dist, gen, amount);
+        return threadLocalRandom(std::uniform_int_distribution<Arithmetic>(min, max), amount);
     }
     else {
-        std::uniform_real_distribution<Arithmetic> dist(min, max);
-        return random(dist, gen, amount);
+        return threadLocalRandom(std::uniform_real_distribution<Arithmetic>(min, max), amount);
     }
 }
 #    else
 /**
  * @brief Returns an iterator view object that generates a sequence of random numbers, using an uniform distribution.
  * @details This random access iterator view object can be used to generate a sequence of random numbers between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence of 8 x `std::random_device` as seed. The
- * seed sequence is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
+ * [`min, max`]. It uses a std::mt19937 random engine per thread (see `lz::threadLocalRandom`), so the view can be iterated
+ * over from several threads at once. Every engine is seeded with a seed sequence of 8 x `std::random_device`. The seed sequence
+ * is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
  * tends to be more faster than its `std::seed_seq` implementation.
  * @param min The minimum value , included.
  * @param max The maximum value, included.
@@ -233,18 +297,18 @@ random(const Arithmetic min, const Arithmetic max, const std::size_t amount = (s
  */
 template<class Integral>
 LZ_NODISCARD
-internal::EnableIf<std::is_integral<Integral>::value, Random<Integral, std::uniform_int_distribution<Integral>, std::mt19937>>
+internal::EnableIf<std::is_integral<Integral>::value,
+                   Random<Integral, std::uniform_int_distribution<Integral>, internal::ThreadLocalEngine<std::mt19937>>>
 random(const Integral min, const Integral max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    static std::mt19937 gen = internal::createMtEngine();
-    std::uniform_int_distribution<Integral> dist(min, max);
-    return random(dist, gen, amount);
+    return threadLocalRandom(std::uniform_int_distribution<Integral>(min, max), amount);
 }
 
 /**
  * @brief Returns an output view object that generates a sequence of floating point doubles, using a uniform
  * distribution.
  * @details This random access iterator view object can be used to generate a sequence of random doubles between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed of `std::random_device` as seed.
+ * [`min, max`]. It uses a std::mt19937 random engine per thread (see `lz::threadLocalRandom`), so the view can be iterated
+ * over from several threads at once. Every engine is seeded with a seed sequence of 8 x `std::random_device`.
  * @tparam Distribution The distribution for generating the random numbers. `std::uniform_real_distribution` by default.
  * @tparam Generator The random number generator. `std::mt19937` by default.
  * @param min The minimum value, included.
@@ -255,11 +319,10 @@ random(const Integral min, const Integral max, const std::size_t amount = (std::
  */
 template<class Floating>
 LZ_NODISCARD internal::EnableIf<std::is_floating_point<Floating>::value,
-                                Random<Floating, std::uniform_real_distribution<Floating>, std::mt19937>>
+                                Random<Floating, std::uniform_real_distribution<Floating>,
+                                       internal::ThreadLocalEngine<std::mt19937>>>
 random(const Floating min, const Floating max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    static std::mt19937 gen = internal::createMtEngine();
-    std::uniform_real_distribution<Floating> dist(min, max);
-    return random(dist, gen, amount);
+    return threadLocalRandom(std::uniform_real_distribution<Floating>(min, max), amount);
 }
 
 #    endif // __cpp_if_constexpr
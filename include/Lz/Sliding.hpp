@@ -0,0 +1,167 @@
+#pragma once
+
+#ifndef LZ_SLIDING_HPP
+#    define LZ_SLIDING_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/SlidingIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class Iterator, class Aggregate>
+class Sliding final : public internal::BasicIteratorView<internal::SlidingIterator<Iterator, Aggregate>> {
+public:
+    using iterator = internal::SlidingIterator<Iterator, Aggregate>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Sliding(Iterator begin, Iterator end, Aggregate aggregate) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, aggregate, false), iterator(end, end, aggregate, true)) {
+    }
+
+    Sliding() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Returns the sum of every window of `windowSize` consecutive elements, i.e. `lz::slidingSum({1, 2, 3, 4}, 2)` yields
+ * `{3, 5, 7}`. Every step adds the incoming element and subtracts the outgoing one, so every step is O(1). Floating point
+ * sums are Kahan compensated and recomputed from the window every `windowSize` steps. If the sequence contains less than
+ * `windowSize` elements, nothing is returned.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Sliding<Iterator, internal::SlidingSumAggregate<internal::ValueType<Iterator>>>
+slidingSumRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    using Aggregate = internal::SlidingSumAggregate<internal::ValueType<Iterator>>;
+    return { std::move(begin), std::move(end), Aggregate(windowSize) };
+}
+
+/**
+ * Returns the sum of every window of `windowSize` consecutive elements, i.e. `lz::slidingSum({1, 2, 3, 4}, 2)` yields
+ * `{3, 5, 7}`. Every step adds the incoming element and subtracts the outgoing one, so every step is O(1). Floating point
+ * sums are Kahan compensated and recomputed from the window every `windowSize` steps. If the sequence contains less than
+ * `windowSize` elements, nothing is returned.
+ * @param iterable The sequence to get the window sums of.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Sliding<I, internal::SlidingSumAggregate<internal::ValueType<I>>>
+slidingSum(Iterable&& iterable, const std::size_t windowSize) {
+    return slidingSumRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize);
+}
+
+/**
+ * Returns the mean of every window of `windowSize` consecutive elements, i.e. `lz::slidingMean({1, 2, 3, 4}, 2)` yields
+ * `{1.5, 2.5, 3.5}`. The means are computed from a running sum, see `slidingSum`. The mean of integral types is a `double`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Sliding<Iterator, internal::SlidingMeanAggregate<internal::ValueType<Iterator>>>
+slidingMeanRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    using Aggregate = internal::SlidingMeanAggregate<internal::ValueType<Iterator>>;
+    return { std::move(begin), std::move(end), Aggregate(windowSize) };
+}
+
+/**
+ * Returns the mean of every window of `windowSize` consecutive elements, i.e. `lz::slidingMean({1, 2, 3, 4}, 2)` yields
+ * `{1.5, 2.5, 3.5}`. The means are computed from a running sum, see `slidingSum`. The mean of integral types is a `double`.
+ * @param iterable The sequence to get the window means of.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Sliding<I, internal::SlidingMeanAggregate<internal::ValueType<I>>>
+slidingMean(Iterable&& iterable, const std::size_t windowSize) {
+    return slidingMeanRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            windowSize);
+}
+
+/**
+ * Returns the minimum of every window of `windowSize` consecutive elements, i.e. `lz::slidingMin({3, 1, 4, 5}, 2)` yields
+ * `{1, 1, 4}`. A monotonic deque is used, which takes amortized O(1) per element, also for input iterators.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD Sliding<Iterator, internal::SlidingExtremeAggregate<internal::ValueType<Iterator>, Compare, false>>
+slidingMinRange(Iterator begin, Iterator end, const std::size_t windowSize, Compare compare = {}) {
+    using Aggregate = internal::SlidingExtremeAggregate<internal::ValueType<Iterator>, Compare, false>;
+    return { std::move(begin), std::move(end), Aggregate(windowSize, std::move(compare)) };
+}
+
+/**
+ * Returns the minimum of every window of `windowSize` consecutive elements, i.e. `lz::slidingMin({3, 1, 4, 5}, 2)` yields
+ * `{1, 1, 4}`. A monotonic deque is used, which takes amortized O(1) per element, also for input iterators.
+ * @param iterable The sequence to get the window minimums of.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>,
+         class Compare = MAKE_BIN_OP(std::less, internal::ValueType<I>)>
+LZ_NODISCARD Sliding<I, internal::SlidingExtremeAggregate<internal::ValueType<I>, Compare, false>>
+slidingMin(Iterable&& iterable, const std::size_t windowSize, Compare compare = {}) {
+    return slidingMinRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize, std::move(compare));
+}
+
+/**
+ * Returns the maximum of every window of `windowSize` consecutive elements, i.e. `lz::slidingMax({3, 1, 4, 5}, 2)` yields
+ * `{3, 4, 5}`. A monotonic deque is used, which takes amortized O(1) per element, also for input iterators.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD Sliding<Iterator, internal::SlidingExtremeAggregate<internal::ValueType<Iterator>, Compare, true>>
+slidingMaxRange(Iterator begin, Iterator end, const std::size_t windowSize, Compare compare = {}) {
+    using Aggregate = internal::SlidingExtremeAggregate<internal::ValueType<Iterator>, Compare, true>;
+    return { std::move(begin), std::move(end), Aggregate(windowSize, std::move(compare)) };
+}
+
+/**
+ * Returns the maximum of every window of `windowSize` consecutive elements, i.e. `lz::slidingMax({3, 1, 4, 5}, 2)` yields
+ * `{3, 4, 5}`. A monotonic deque is used, which takes amortized O(1) per element, also for input iterators.
+ * @param iterable The sequence to get the window maximums of.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sliding iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>,
+         class Compare = MAKE_BIN_OP(std::less, internal::ValueType<I>)>
+LZ_NODISCARD Sliding<I, internal::SlidingExtremeAggregate<internal::ValueType<I>, Compare, true>>
+slidingMax(Iterable&& iterable, const std::size_t windowSize, Compare compare = {}) {
+    return slidingMaxRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize, std::move(compare));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_SLIDING_HPP
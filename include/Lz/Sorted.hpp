@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef LZ_SORTED_HPP
+#    define LZ_SORTED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/SortedIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class T, class Compare>
+class Sorted final : public internal::BasicIteratorView<internal::SortedIterator<T, Compare>> {
+    using State = internal::IncrementalSort<T, Compare>;
+
+    static Sorted create(std::shared_ptr<State> state) {
+        const std::size_t size = state->size();
+        return { iterator(state, 0), iterator(state, size) };
+    }
+
+public:
+    using iterator = internal::SortedIterator<T, Compare>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    template<class Iterator>
+    Sorted(Iterator begin, Iterator end, Compare compare) :
+        Sorted(create(std::make_shared<State>(std::move(begin), std::move(end), std::move(compare)))) {
+    }
+
+    Sorted(iterator begin, iterator end) : internal::BasicIteratorView<iterator>(std::move(begin), std::move(end)) {
+    }
+
+    Sorted() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a forward iterator that sorts a sequence lazily.
+ * @details The sequence is copied once, after which it is sorted incrementally (incremental quicksort): only the part that is
+ * needed to produce the next element is partitioned. Taking the first `k` elements therefore costs O(n + k log k) instead of
+ * O(n log n). The elements that are not iterated over are never sorted. Iterators of the same view share the sorted elements.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD Sorted<internal::ValueType<Iterator>, Compare> sortedRange(Iterator begin, Iterator end, Compare compare = {}) {
+    return { std::move(begin), std::move(end), std::move(compare) };
+}
+
+/**
+ * @brief Returns a forward iterator that sorts a sequence lazily.
+ * @details The sequence is copied once, after which it is sorted incrementally (incremental quicksort): only the part that is
+ * needed to produce the next element is partitioned. Taking the first `k` elements therefore costs O(n + k log k) instead of
+ * O(n log n). The elements that are not iterated over are never sorted. Iterators of the same view share the sorted elements.
+ * @param iterable The sequence to sort.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A Sorted object that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD Sorted<internal::ValueTypeIterable<Iterable>, Compare> sorted(Iterable&& iterable, Compare compare = {}) {
+    return sortedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                       std::move(compare));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_SORTED_HPP
@@ -0,0 +1,240 @@
+#pragma once
+
+#ifndef LZ_STATS_HPP
+#    define LZ_STATS_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <cmath>
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <execution>
+#        include <numeric>
+#    endif // LZ_HAS_EXECUTION
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * Accumulates the count, sum, mean, variance, min and max of a sequence of arithmetic values in a single pass. The sum is
+ * accumulated in the promoted type of `T` (see `sum_type`), so that sums of small integers are not truncated. The mean and
+ * variance are calculated using Welford's algorithm, which is numerically stable. Two accumulators over different parts of a
+ * sequence can be combined using `merge` (or `operator+`), which gives (up to rounding) the same result as accumulating the
+ * whole sequence at once. This makes it suitable for accumulating partitions in parallel.
+ */
+template<class T>
+class Stats {
+    static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic type");
+
+public:
+    using value_type = T;
+    using sum_type = internal::Decay<decltype(std::declval<T>() + std::declval<T>())>;
+
+private:
+    std::size_t _count{};
+    sum_type _sum{};
+    double _mean{};
+    // Sum of the squared differences from the mean
+    double _m2{};
+    T _min{};
+    T _max{};
+
+public:
+    constexpr Stats() = default;
+
+    /**
+     * Creates an accumulator containing a single value.
+     * @param value The value to add.
+     */
+    constexpr explicit Stats(const T value) :
+        _count(1),
+        _sum(value),
+        _mean(static_cast<double>(value)),
+        _min(value),
+        _max(value) {
+    }
+
+    /**
+     * Adds a value to the accumulator.
+     * @param value The value to add.
+     * @return A reference to this accumulator.
+     */
+    LZ_CONSTEXPR_CXX_14 Stats& add(const T value) noexcept {
+        if (_count == 0) {
+            return *this = Stats(value);
+        }
+        ++_count;
+        _sum = _sum + value;
+        const auto x = static_cast<double>(value);
+        const double delta = x - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (x - _mean);
+        if (value < _min) {
+            _min = value;
+        }
+        if (_max < value) {
+            _max = value;
+        }
+        return *this;
+    }
+
+    /**
+     * Merges the results of another accumulator into this one, using the parallel variance formula of Chan et al.
+     * @param other The accumulator to merge.
+     * @return A reference to this accumulator.
+     */
+    LZ_CONSTEXPR_CXX_14 Stats& merge(const Stats& other) noexcept {
+        if (other._count == 0) {
+            return *this;
+        }
+        if (_count == 0) {
+            return *this = other;
+        }
+        const auto countA = static_cast<double>(_count);
+        const auto countB = static_cast<double>(other._count);
+        const double total = countA + countB;
+        const double delta = other._mean - _mean;
+        _mean += delta * countB / total;
+        _m2 += other._m2 + delta * delta * countA * countB / total;
+        _count += other._count;
+        _sum = _sum + other._sum;
+        if (other._min < _min) {
+            _min = other._min;
+        }
+        if (_max < other._max) {
+            _max = other._max;
+        }
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend Stats operator+(Stats a, const Stats& b) noexcept {
+        return a.merge(b);
+    }
+
+    //! Returns the amount of values added.
+    LZ_NODISCARD constexpr std::size_t count() const noexcept {
+        return _count;
+    }
+
+    //! Returns true if no values are added, false otherwise.
+    LZ_NODISCARD constexpr bool empty() const noexcept {
+        return _count == 0;
+    }
+
+    //! Returns the sum of the values, or `sum_type()` if empty.
+    LZ_NODISCARD constexpr sum_type sum() const noexcept {
+        return _sum;
+    }
+
+    //! Returns the mean of the values, or 0 if empty.
+    LZ_NODISCARD constexpr double mean() const noexcept {
+        return _mean;
+    }
+
+    //! Returns the population variance of the values, or 0 if empty.
+    LZ_NODISCARD constexpr double variance() const noexcept {
+        return _count == 0 ? 0. : _m2 / static_cast<double>(_count);
+    }
+
+    //! Returns the sample variance of the values, or 0 if less than two values are added.
+    LZ_NODISCARD constexpr double sampleVariance() const noexcept {
+        return _count < 2 ? 0. : _m2 / static_cast<double>(_count - 1);
+    }
+
+    //! Returns the population standard deviation of the values, or 0 if empty.
+    LZ_NODISCARD double stddev() const noexcept {
+        return std::sqrt(variance());
+    }
+
+    //! Returns the sample standard deviation of the values, or 0 if less than two values are added.
+    LZ_NODISCARD double sampleStddev() const noexcept {
+        return std::sqrt(sampleVariance());
+    }
+
+    //! Returns the smallest value. The accumulator cannot be empty.
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T min() const noexcept {
+        LZ_ASSERT(_count != 0, "stats cannot be empty in order to get min element");
+        return _min;
+    }
+
+    //! Returns the largest value. The accumulator cannot be empty.
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T max() const noexcept {
+        LZ_ASSERT(_count != 0, "stats cannot be empty in order to get max element");
+        return _max;
+    }
+};
+
+#    ifdef LZ_HAS_EXECUTION
+/**
+ * Calculates the count, sum, mean, variance, min and max of a sequence in a single pass, so that a lazy sequence is only
+ * evaluated once. If a parallel execution policy is passed, the sequence is partitioned and the partial results are merged.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A `lz::Stats` object containing the results.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Stats<internal::ValueType<Iterator>>
+stats(Iterator begin, Iterator end, Execution execution = std::execution::seq) {
+    using StatsType = Stats<internal::ValueType<Iterator>>;
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        StatsType result;
+        for (; begin != end; ++begin) {
+            result.add(*begin);
+        }
+        return result;
+    }
+    else {
+        return std::transform_reduce(execution, std::move(begin), std::move(end), StatsType(), std::plus<>(),
+                                     [](const internal::ValueType<Iterator>& value) { return StatsType(value); });
+    }
+}
+
+/**
+ * Calculates the count, sum, mean, variance, min and max of a sequence in a single pass, so that a lazy sequence is only
+ * evaluated once. If a parallel execution policy is passed, the sequence is partitioned and the partial results are merged.
+ * @param iterable The sequence to calculate the statistics of.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A `lz::Stats` object containing the results.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Stats<internal::ValueTypeIterable<Iterable>>
+stats(const Iterable& iterable, Execution execution = std::execution::seq) {
+    return lz::stats(std::begin(iterable), std::end(iterable), execution);
+}
+#    else
+/**
+ * Calculates the count, sum, mean, variance, min and max of a sequence in a single pass, so that a lazy sequence is only
+ * evaluated once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A `lz::Stats` object containing the results.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Stats<internal::ValueType<Iterator>> stats(Iterator begin, Iterator end) {
+    Stats<internal::ValueType<Iterator>> result;
+    for (; begin != end; ++begin) {
+        result.add(*begin);
+    }
+    return result;
+}
+
+/**
+ * Calculates the count, sum, mean, variance, min and max of a sequence in a single pass, so that a lazy sequence is only
+ * evaluated once.
+ * @param iterable The sequence to calculate the statistics of.
+ * @return A `lz::Stats` object containing the results.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Stats<internal::ValueTypeIterable<Iterable>> stats(const Iterable& iterable) {
+    return lz::stats(std::begin(iterable), std::end(iterable));
+}
+#    endif // LZ_HAS_EXECUTION
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_STATS_HPP
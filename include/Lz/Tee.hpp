@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef LZ_TEE_HPP
+#    define LZ_TEE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/TeeIterator.hpp"
+
+#    include <tuple>
+
+namespace lz {
+namespace internal {
+template<class Iterator, class Sinks, std::size_t... I>
+void fanout(Iterator begin, const Iterator& end, Sinks& sinks, IndexSequence<I...>) {
+    for (; begin != end; ++begin) {
+        const auto& value = *begin;
+        const int expand[] = { 0, (static_cast<void>(std::get<I>(sinks)(value)), 0)... };
+        static_cast<void>(expand);
+    }
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Tee final : public internal::BasicIteratorView<internal::TeeIterator<Iterator>> {
+public:
+    using iterator = internal::TeeIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    explicit Tee(std::shared_ptr<internal::TeeConsumer<Iterator>> consumer) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(consumer)), iterator()) {
+    }
+
+    Tee() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns `n` input views over the same sequence, of which the sequence itself is only iterated over once. This is
+ * useful if several results are needed from a sequence that is expensive to evaluate, i.e.
+ * `auto views = lz::tee(expensive, 2); for (const auto& pair : lz::zip(views[0], views[1].map(project))) { ... }`.
+ * @details Every element is evaluated once, and is buffered until all views have passed it, so the buffer only holds the
+ * elements between the slowest and the fastest view. If the views are iterated over in lockstep (i.e. using `lz::zip`), at
+ * most one element is buffered. If one view is iterated over completely before the others, the whole sequence is buffered, in
+ * which case `lz::fanout` is the better choice. A view that is destroyed no longer holds back the others. The views are not
+ * thread safe, and every view can only be iterated over once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param n The amount of views.
+ * @return A vector of `n` Tee objects that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD std::vector<Tee<Iterator>> teeRange(Iterator begin, Iterator end, const std::size_t n) {
+    const auto state = std::make_shared<internal::TeeState<Iterator>>(std::move(begin), std::move(end), n);
+    std::vector<Tee<Iterator>> views;
+    views.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        views.emplace_back(std::make_shared<internal::TeeConsumer<Iterator>>(state, i));
+    }
+    return views;
+}
+
+/**
+ * @brief Returns `n` input views over the same sequence, of which the sequence itself is only iterated over once. See
+ * `lz::teeRange` for details.
+ * @param iterable The sequence to share between the views.
+ * @param n The amount of views.
+ * @return A vector of `n` Tee objects that can be converted to an arbitrary container or can be iterated over.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<Tee<internal::IterTypeFromIterable<Iterable>>> tee(Iterable&& iterable, const std::size_t n) {
+    return teeRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), n);
+}
+
+/**
+ * @brief Iterates over `iterable` once, and calls every sink with every element, i.e.
+ * `auto sinks = lz::fanout(view, Counter{}, Histogram{});`. This computes several results in a single pass over a sequence that
+ * is expensive to evaluate, without buffering it.
+ * @param iterable The sequence to iterate over.
+ * @param sinks Function objects that are called with every element as `sink(const value_type&)`, in the order they are passed.
+ * @return A tuple containing the sinks after every element has been passed to them, so that their results can be read.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class... Sinks>
+std::tuple<internal::Decay<Sinks>...> fanout(Iterable&& iterable, Sinks&&... sinks) {
+    std::tuple<internal::Decay<Sinks>...> result(std::forward<Sinks>(sinks)...);
+    internal::fanout(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), result,
+                     internal::MakeIndexSequence<sizeof...(Sinks)>());
+    return result;
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_TEE_HPP
@@ -0,0 +1,299 @@
+#pragma once
+
+#ifndef LZ_THREAD_POOL_HPP
+#    define LZ_THREAD_POOL_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <deque>
+#    include <exception>
+#    include <functional>
+#    include <memory>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+using Task = std::function<void()>;
+
+// The tasks of one worker. The worker itself takes the task that was pushed last, which is most likely still in its cache, while
+// other workers steal the task that was pushed first, which is most likely the largest amount of remaining work
+class WorkQueue {
+    std::deque<Task> _tasks{};
+    std::mutex _mutex{};
+
+public:
+    void push(Task task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+
+    bool pop(Task& task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_tasks.empty()) {
+            return false;
+        }
+        task = std::move(_tasks.back());
+        _tasks.pop_back();
+        return true;
+    }
+
+    bool steal(Task& task) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_tasks.empty()) {
+            return false;
+        }
+        task = std::move(_tasks.front());
+        _tasks.pop_front();
+        return true;
+    }
+};
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @brief A thread pool in which every worker has its own queue of tasks, and steals tasks from the other workers if its own queue
+ * is empty. It is the default executor of the parallel functions in Parallel.hpp (i.e. `lz::parallelForEach`), and does not
+ * depend on `std::execution`. The threads are started once and reused by every call.
+ * @details An executor is any object with a member function `run(parts, function)`, that calls `function(part)` for every part in
+ * [0, parts) and returns after all parts have finished. Custom executors can be passed to the parallel functions instead.
+ */
+class ThreadPool {
+    std::vector<std::unique_ptr<internal::WorkQueue>> _queues{};
+    std::vector<std::thread> _threads{};
+    std::mutex _mutex{};
+    std::condition_variable _condition{};
+    // The amount of tasks that have been submitted, but have not been taken by a worker yet
+    std::atomic<std::size_t> _pending{ 0 };
+    std::atomic<std::size_t> _next{ 0 };
+    bool _stop{ false };
+    // Threads that wait for tasks to finish (see `waitUntil`) block on this condition if there are no tasks to run
+    std::mutex _waitMutex{};
+    std::condition_variable _changed{};
+    std::atomic<std::size_t> _waiting{ 0 };
+
+    static constexpr int Spins = 64;
+
+    struct Worker {
+        const ThreadPool* pool;
+        std::size_t index;
+    };
+
+    static Worker& currentWorker() noexcept {
+        static thread_local Worker worker{ nullptr, 0 };
+        return worker;
+    }
+
+    // The index of the queue of the calling thread, or the amount of queues if the calling thread is not a worker of this pool
+    std::size_t currentIndex() const noexcept {
+        const Worker& worker = currentWorker();
+        return worker.pool == this ? worker.index : _queues.size();
+    }
+
+    bool take(const std::size_t index, internal::Task& task) {
+        const std::size_t size = _queues.size();
+        if (index < size && _queues[index]->pop(task)) {
+            _pending.fetch_sub(1);
+            return true;
+        }
+        for (std::size_t i = 1; i <= size; ++i) {
+            if (_queues[(index + i) % size]->steal(task)) {
+                _pending.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Wakes the threads that block in `waitUntil`. The waiters are counted before they check their condition while holding the
+    // mutex, so if none are counted, a thread that starts to wait sees the change that was made before this call
+    void notifyWaiters() {
+        if (_waiting.load() != 0) {
+            std::lock_guard<std::mutex> lock(_waitMutex);
+            _changed.notify_all();
+        }
+    }
+
+    void work(const std::size_t index) {
+        currentWorker() = Worker{ this, index };
+        internal::Task task;
+        while (true) {
+            if (take(index, task)) {
+                task();
+                task = nullptr;
+                notifyWaiters();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this] { return _stop || _pending.load() != 0; });
+            if (_stop && _pending.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threads The amount of worker threads. Defaults to the amount of hardware threads.
+     */
+    explicit ThreadPool(std::size_t threads = 0) {
+        if (threads == 0) {
+            threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+        }
+        _queues.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            _queues.push_back(std::unique_ptr<internal::WorkQueue>(new internal::WorkQueue()));
+        }
+        _threads.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            _threads.emplace_back(&ThreadPool::work, this, i);
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Finishes the tasks that have been submitted, and stops the worker threads.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _condition.notify_all();
+        for (std::thread& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief The thread pool that is used by the parallel functions if no executor is passed. It is started on first use.
+     */
+    static ThreadPool& global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Returns the amount of worker threads.
+     */
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _threads.size();
+    }
+
+    /**
+     * @brief Submits a task to the pool. Tasks that are submitted by a worker are pushed to its own queue, other tasks are
+     * distributed over the queues round robin.
+     * @param task The task to run. It must not throw.
+     */
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending.fetch_add(1);
+        }
+        std::size_t index = currentIndex();
+        if (index == _queues.size()) {
+            index = _next.fetch_add(1) % _queues.size();
+        }
+        _queues[index]->push(std::move(task));
+        _condition.notify_one();
+        notifyWaiters();
+    }
+
+    /**
+     * @brief Runs one task that has been submitted to the pool on the calling thread, if there is one. Threads that wait for
+     * tasks of the pool to finish can call this, instead of blocking a worker.
+     * @return True if a task was run, false otherwise.
+     */
+    bool runPending() {
+        internal::Task task;
+        if (!take(currentIndex(), task)) {
+            return false;
+        }
+        task();
+        task = nullptr;
+        notifyWaiters();
+        return true;
+    }
+
+    /**
+     * @brief Runs tasks of the pool on the calling thread until `done()` returns true. If there are no tasks to run, the calling
+     * thread spins shortly, and then blocks until a task finishes or is submitted, so that it does not occupy a core while the
+     * workers finish the remaining tasks.
+     * @param done Returns true if the calling thread can stop waiting. It must only become true when a task of this pool
+     * finishes, and is called concurrently with the tasks.
+     */
+    template<class Predicate>
+    void waitUntil(const Predicate& done) {
+        int spins = 0;
+        while (!done()) {
+            if (runPending()) {
+                spins = 0;
+                continue;
+            }
+            if (spins < Spins) {
+                ++spins;
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_waitMutex);
+            _waiting.fetch_add(1);
+            _changed.wait(lock, [this, &done] { return done() || _pending.load() != 0; });
+            _waiting.fetch_sub(1);
+            spins = 0;
+        }
+    }
+
+    /**
+     * @brief Calls `function(part)` for every part in [0, parts), and returns after all parts have finished. Part 0 is run on the
+     * calling thread, which runs other tasks of the pool while it waits for the rest (see `waitUntil`), so `run` can be called
+     * from within a task as well. The first exception that is thrown by `function` is rethrown after all parts have finished.
+     * @param parts The amount of parts.
+     * @param function The function to call for every part. It is called concurrently.
+     */
+    template<class Function>
+    void run(const std::size_t parts, const Function& function) {
+        if (parts == 0) {
+            return;
+        }
+        std::vector<std::exception_ptr> errors(parts);
+        std::atomic<std::size_t> remaining(parts - 1);
+        const auto runPart = [&function, &errors](const std::size_t part) {
+            try {
+                function(part);
+            }
+            catch (...) {
+                errors[part] = std::current_exception();
+            }
+        };
+
+        for (std::size_t part = 1; part < parts; ++part) {
+            submit([&runPart, &remaining, part] {
+                runPart(part);
+                remaining.fetch_sub(1);
+            });
+        }
+        runPart(0);
+
+        waitUntil([&remaining] { return remaining.load() == 0; });
+
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+};
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_THREAD_POOL_HPP
@@ -0,0 +1,397 @@
+#pragma once
+
+#ifndef LZ_TOP_K_HPP
+#    define LZ_TOP_K_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <algorithm>
+#    include <functional>
+#    include <utility>
+#    include <vector>
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <execution>
+#        include <numeric>
+#        include <thread>
+#    endif // LZ_HAS_EXECUTION
+
+namespace lz {
+namespace internal {
+// Keeps the k largest (according to Compare) values that are pushed, using O(k) memory. The heap is ordered such that the
+// smallest of the kept values is at the front, so a new value only has to be compared to the front
+template<class T, class Compare>
+class BoundedHeap {
+    struct HeapCompare {
+        Compare compare;
+
+        bool operator()(const T& a, const T& b) const {
+            return compare(b, a);
+        }
+    };
+
+    std::vector<T> _heap{};
+    std::size_t _k{};
+    HeapCompare _compare;
+
+public:
+    // Only reserves for the elements that are known to arrive, so that a large `k` does not allocate `k` elements up front
+    BoundedHeap(const std::size_t k, Compare compare, const std::size_t expected) : _k(k), _compare{ std::move(compare) } {
+        _heap.reserve((std::min)(k, expected));
+    }
+
+    void push(T value) {
+        if (_heap.size() < _k) {
+            _heap.push_back(std::move(value));
+            std::push_heap(_heap.begin(), _heap.end(), _compare);
+        }
+        else if (_k != 0 && _compare.compare(_heap.front(), value)) {
+            std::pop_heap(_heap.begin(), _heap.end(), _compare);
+            _heap.back() = std::move(value);
+            std::push_heap(_heap.begin(), _heap.end(), _compare);
+        }
+    }
+
+    // Returns the kept values, largest first
+    std::vector<T> release() {
+        std::sort_heap(_heap.begin(), _heap.end(), _compare);
+        return std::move(_heap);
+    }
+};
+
+template<class Compare>
+struct ReverseCompare {
+    Compare compare;
+
+    template<class T>
+    bool operator()(const T& a, const T& b) const {
+        return compare(b, a);
+    }
+};
+
+template<class Compare>
+struct FirstCompare {
+    Compare compare;
+
+    template<class T>
+    bool operator()(const T& a, const T& b) const {
+        return compare(a.first, b.first);
+    }
+};
+
+// Converts an element of the sequence to the value that is stored in the heap
+template<class T>
+struct Identity {
+    template<class U>
+    T operator()(U&& value) const {
+        return std::forward<U>(value);
+    }
+};
+
+template<class Key, class T, class KeySelector>
+struct KeyWithValue {
+    mutable KeySelector keySelector;
+
+    template<class U>
+    std::pair<Key, T> operator()(U&& value) const {
+        Key key = keySelector(value);
+        return { std::move(key), std::forward<U>(value) };
+    }
+};
+
+template<class T, class Iterator, class MakeValue, class Compare>
+BoundedHeap<T, Compare> boundedHeap(Iterator begin, Iterator end, const std::size_t k, MakeValue makeValue, Compare compare) {
+    BoundedHeap<T, Compare> heap(k, std::move(compare), static_cast<std::size_t>(sizeHint(begin, end)));
+    for (; begin != end; ++begin) {
+        heap.push(makeValue(*begin));
+    }
+    return heap;
+}
+
+#    ifdef LZ_HAS_EXECUTION
+// Builds a heap per partition in parallel, after which the heaps are merged
+template<class T, class Iterator, class MakeValue, class Compare, class Execution>
+std::vector<T> topKImpl(Iterator begin, Iterator end, const std::size_t k, MakeValue makeValue, Compare compare,
+                        Execution execution) {
+    if constexpr (checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        return boundedHeap<T>(std::move(begin), std::move(end), k, std::move(makeValue), std::move(compare)).release();
+    }
+    else {
+        const auto size = static_cast<std::size_t>(std::distance(begin, end));
+        const std::size_t partitions = std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), size));
+        std::vector<Iterator> bounds;
+        bounds.reserve(partitions + 1);
+        bounds.push_back(begin);
+        for (std::size_t i = 1; i < partitions; ++i) {
+            bounds.push_back(std::next(bounds.back(), static_cast<DiffType<Iterator>>(size / partitions)));
+        }
+        bounds.push_back(std::move(end));
+
+        std::vector<std::vector<T>> partials(partitions);
+        std::vector<std::size_t> indices(partitions);
+        std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+        std::for_each(execution, indices.begin(), indices.end(), [&](const std::size_t i) {
+            partials[i] = boundedHeap<T>(bounds[i], bounds[i + 1], k, makeValue, compare).release();
+        });
+
+        std::size_t kept = 0;
+        for (const std::vector<T>& partial : partials) {
+            kept += partial.size();
+        }
+        BoundedHeap<T, Compare> heap(k, std::move(compare), kept);
+        for (std::vector<T>& partial : partials) {
+            for (T& value : partial) {
+                heap.push(std::move(value));
+            }
+        }
+        return heap.release();
+    }
+}
+#    else
+template<class T, class Iterator, class MakeValue, class Compare>
+std::vector<T> topKImpl(Iterator begin, Iterator end, const std::size_t k, MakeValue makeValue, Compare compare) {
+    return boundedHeap<T>(std::move(begin), std::move(end), k, std::move(makeValue), std::move(compare)).release();
+}
+#    endif // LZ_HAS_EXECUTION
+
+template<class T, class Key>
+std::vector<T> dropKeys(std::vector<std::pair<Key, T>>&& pairs) {
+    std::vector<T> result;
+    result.reserve(pairs.size());
+    for (std::pair<Key, T>& pair : pairs) {
+        result.push_back(std::move(pair.second));
+    }
+    return result;
+}
+} // namespace internal
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+#    ifdef LZ_HAS_EXECUTION
+/**
+ * Gets the `k` largest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence. If a parallel execution policy is passed, a heap is built per partition and the heaps are merged afterwards.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, largest first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>),
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topK(Iterator begin, Iterator end, const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    return internal::topKImpl<ValueType>(std::move(begin), std::move(end), k, internal::Identity<ValueType>(),
+                                         std::move(compare), execution);
+}
+
+/**
+ * Gets the `k` largest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence. If a parallel execution policy is passed, a heap is built per partition and the heaps are merged afterwards.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, largest first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>),
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+topK(const Iterable& iterable, const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) {
+    return lz::topK(std::begin(iterable), std::end(iterable), k, std::move(compare), execution);
+}
+
+/**
+ * Gets the `k` smallest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence. If a parallel execution policy is passed, a heap is built per partition and the heaps are merged afterwards.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, smallest first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>),
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+bottomK(Iterator begin, Iterator end, const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) {
+    return lz::topK(std::move(begin), std::move(end), k, internal::ReverseCompare<Compare>{ std::move(compare) }, execution);
+}
+
+/**
+ * Gets the `k` smallest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence. If a parallel execution policy is passed, a heap is built per partition and the heaps are merged afterwards.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, smallest first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>),
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+bottomK(const Iterable& iterable, const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) {
+    return lz::bottomK(std::begin(iterable), std::end(iterable), k, std::move(compare), execution);
+}
+
+/**
+ * Gets the `k` elements of a sequence with the largest keys in a single pass, keeping a heap of at most `k` elements. The key
+ * of every element is evaluated exactly once. If a parallel execution policy is passed, a heap is built per partition and the
+ * heaps are merged afterwards.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param keySelector Function that returns the key of an element. Signature: `Key keySelector(const value_type&)`.
+ * @param compare The comparer of the keys. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, the one with the largest key first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector,
+         class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const internal::ValueType<Iterator>&>>,
+         class Compare = MAKE_BIN_OP(std::less, Key), class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>> topKBy(Iterator begin, Iterator end, const std::size_t k,
+                                                               KeySelector keySelector, Compare compare = {},
+                                                               Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    using Pair = std::pair<Key, ValueType>;
+    return internal::dropKeys(internal::topKImpl<Pair>(std::move(begin), std::move(end), k,
+                                                       internal::KeyWithValue<Key, ValueType, KeySelector>{ std::move(keySelector) },
+                                                       internal::FirstCompare<Compare>{ std::move(compare) }, execution));
+}
+
+/**
+ * Gets the `k` elements of a sequence with the largest keys in a single pass, keeping a heap of at most `k` elements. The key
+ * of every element is evaluated exactly once. If a parallel execution policy is passed, a heap is built per partition and the
+ * heaps are merged afterwards.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param keySelector Function that returns the key of an element. Signature: `Key keySelector(const value_type&)`.
+ * @param compare The comparer of the keys. `operator<` is assumed by default.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A vector containing at most `k` elements, the one with the largest key first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const internal::ValueTypeIterable<Iterable>&>>,
+         class Compare = MAKE_BIN_OP(std::less, Key), class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>> topKBy(const Iterable& iterable, const std::size_t k,
+                                                                       KeySelector keySelector, Compare compare = {},
+                                                                       Execution execution = std::execution::seq) {
+    return lz::topKBy(std::begin(iterable), std::end(iterable), k, std::move(keySelector), std::move(compare), execution);
+}
+#    else
+/**
+ * Gets the `k` largest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, largest first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>> topK(Iterator begin, Iterator end, const std::size_t k, Compare compare = {}) {
+    using ValueType = internal::ValueType<Iterator>;
+    return internal::topKImpl<ValueType>(std::move(begin), std::move(end), k, internal::Identity<ValueType>(), std::move(compare));
+}
+
+/**
+ * Gets the `k` largest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, largest first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+topK(const Iterable& iterable, const std::size_t k, Compare compare = {}) {
+    return lz::topK(std::begin(iterable), std::end(iterable), k, std::move(compare));
+}
+
+/**
+ * Gets the `k` smallest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, smallest first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = MAKE_BIN_OP(std::less, internal::ValueType<Iterator>)>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+bottomK(Iterator begin, Iterator end, const std::size_t k, Compare compare = {}) {
+    return lz::topK(std::move(begin), std::move(end), k, internal::ReverseCompare<Compare>{ std::move(compare) });
+}
+
+/**
+ * Gets the `k` smallest elements of a sequence in a single pass, keeping a heap of at most `k` elements instead of copying the
+ * whole sequence.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param compare The comparer. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, smallest first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = MAKE_BIN_OP(std::less, internal::ValueTypeIterable<Iterable>)>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+bottomK(const Iterable& iterable, const std::size_t k, Compare compare = {}) {
+    return lz::bottomK(std::begin(iterable), std::end(iterable), k, std::move(compare));
+}
+
+/**
+ * Gets the `k` elements of a sequence with the largest keys in a single pass, keeping a heap of at most `k` elements. The key
+ * of every element is evaluated exactly once.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param keySelector Function that returns the key of an element. Signature: `Key keySelector(const value_type&)`.
+ * @param compare The comparer of the keys. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, the one with the largest key first.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class KeySelector,
+         class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const internal::ValueType<Iterator>&>>,
+         class Compare = MAKE_BIN_OP(std::less, Key)>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topKBy(Iterator begin, Iterator end, const std::size_t k, KeySelector keySelector, Compare compare = {}) {
+    using ValueType = internal::ValueType<Iterator>;
+    using Pair = std::pair<Key, ValueType>;
+    return internal::dropKeys(internal::topKImpl<Pair>(std::move(begin), std::move(end), k,
+                                                       internal::KeyWithValue<Key, ValueType, KeySelector>{ std::move(keySelector) },
+                                                       internal::FirstCompare<Compare>{ std::move(compare) }));
+}
+
+/**
+ * Gets the `k` elements of a sequence with the largest keys in a single pass, keeping a heap of at most `k` elements. The key
+ * of every element is evaluated exactly once.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param keySelector Function that returns the key of an element. Signature: `Key keySelector(const value_type&)`.
+ * @param compare The comparer of the keys. `operator<` is assumed by default.
+ * @return A vector containing at most `k` elements, the one with the largest key first.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Key = internal::Decay<internal::FunctionReturnType<KeySelector, const internal::ValueTypeIterable<Iterable>&>>,
+         class Compare = MAKE_BIN_OP(std::less, Key)>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+topKBy(const Iterable& iterable, const std::size_t k, KeySelector keySelector, Compare compare = {}) {
+    return lz::topKBy(std::begin(iterable), std::end(iterable), k, std::move(keySelector), std::move(compare));
+}
+#    endif // LZ_HAS_EXECUTION
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_TOP_K_HPP
@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef LZ_WINDOW_HPP
+#    define LZ_WINDOW_HPP
+
+#    include "detail/WindowIterator.hpp"
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class Iterator>
+class Window final : public internal::BasicIteratorView<internal::WindowIterator<Iterator>> {
+public:
+    using iterator = internal::WindowIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Window(Iterator begin, Iterator end, const std::size_t windowSize) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, windowSize, false), iterator(end, end, windowSize, true)) {
+    }
+
+    constexpr Window() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Returns all windows of `windowSize` consecutive elements of a sequence, i.e. `lz::window({1, 2, 3, 4}, 3)` yields
+ * `{1, 2, 3}` and `{2, 3, 4}`. The elements are kept in a ring buffer, so every element of the sequence is dereferenced only
+ * once, which makes this also usable with input iterators. Every window is a view over the ring buffer, that shares it with the
+ * iterator. The ring buffer is only copied if the iterator is incremented while a window or a copy of the iterator still uses it,
+ * so a window stays valid, and iterating while only keeping the current window is O(1) per step. If the sequence contains less
+ * than `windowSize` elements, no windows are returned.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Window iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Window<Iterator> windowRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    return { std::move(begin), std::move(end), windowSize };
+}
+
+/**
+ * Returns all windows of `windowSize` consecutive elements of a sequence, i.e. `lz::window({1, 2, 3, 4}, 3)` yields
+ * `{1, 2, 3}` and `{2, 3, 4}`. The elements are kept in a ring buffer, so every element of the sequence is dereferenced only
+ * once, which makes this also usable with input iterators. Every window is a view over the ring buffer, that shares it with the
+ * iterator. The ring buffer is only copied if the iterator is incremented while a window or a copy of the iterator still uses it,
+ * so a window stays valid, and iterating while only keeping the current window is O(1) per step. If the sequence contains less
+ * than `windowSize` elements, no windows are returned.
+ * @param iterable The sequence to get the windows of.
+ * @param windowSize The amount of elements of every window. Must be greater than 0.
+ * @return A Window iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Window<I> window(Iterable&& iterable, const std::size_t windowSize) {
+    return windowRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                       windowSize);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+} // namespace lz
+
+#endif // LZ_WINDOW_HPP
@@ -0,0 +1,280 @@
+#pragma once
+
+#ifndef LZ_ALGORITHM_HPP
+#    define LZ_ALGORITHM_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <functional>
+#    include <string>
+#    include <vector>
+
+#    if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#        define LZ_HAS_SSE2
+#        include <emmintrin.h>
+#    endif // SSE2
+
+namespace lz {
+namespace internal {
+#    ifdef LZ_HAS_CONCEPTS
+template<class Iterator>
+struct IsContiguous : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {};
+#    else
+// Pre C++20 there is no way of detecting contiguous iterators, so only the most common ones are recognised
+template<class Iterator, class T = ValueType<Iterator>>
+struct IsContiguous
+    : std::integral_constant<bool, std::is_pointer<Iterator>::value ||
+                                       (!std::is_same<T, bool>::value &&
+                                        (std::is_same<Iterator, typename std::vector<T>::iterator>::value ||
+                                         std::is_same<Iterator, typename std::vector<T>::const_iterator>::value)) ||
+                                       std::is_same<Iterator, std::string::iterator>::value ||
+                                       std::is_same<Iterator, std::string::const_iterator>::value> {};
+#    endif // LZ_HAS_CONCEPTS
+
+// Backends for searching and comparing. If the sequence is contiguous and its value type is an integer, the search is done
+// using memchr/SSE2 and comparisons using memcmp. Otherwise, the generic algorithms are used.
+
+template<class T>
+struct IsSimdComparable
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                       (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+// Types of which equality is equal to equality of their object representation
+template<class T>
+struct IsMemComparable
+    : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+template<class BinaryPredicate, class T>
+struct IsDefaultEqualTo : std::integral_constant<bool, std::is_same<BinaryPredicate, std::equal_to<T>>::value ||
+                                                           std::is_same<BinaryPredicate, std::equal_to<void>>::value> {};
+
+template<class Iterator, class T>
+struct HasFastFind : std::integral_constant<bool, IsContiguous<Iterator>::value && IsSimdComparable<ValueType<Iterator>>::value &&
+                                                      std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+struct HasFastEqual
+    : std::integral_constant<bool, IsContiguous<IteratorA>::value && IsContiguous<IteratorB>::value &&
+                                       std::is_same<ValueType<IteratorA>, ValueType<IteratorB>>::value &&
+                                       IsMemComparable<ValueType<IteratorA>>::value &&
+                                       IsDefaultEqualTo<BinaryPredicate, ValueType<IteratorA>>::value> {};
+
+inline int popCount(unsigned int value) noexcept {
+#    if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(value);
+#    else
+    int count = 0;
+    for (; value != 0; value &= value - 1) {
+        ++count;
+    }
+    return count;
+#    endif
+}
+
+#    ifdef LZ_HAS_SSE2
+template<std::size_t Size>
+struct Sse2Lanes;
+
+template<>
+struct Sse2Lanes<1> {
+    template<class T>
+    static __m128i broadcast(const T value) noexcept {
+        return _mm_set1_epi8(static_cast<char>(value));
+    }
+
+    static __m128i compare(const __m128i a, const __m128i b) noexcept {
+        return _mm_cmpeq_epi8(a, b);
+    }
+};
+
+template<>
+struct Sse2Lanes<2> {
+    template<class T>
+    static __m128i broadcast(const T value) noexcept {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }
+
+    static __m128i compare(const __m128i a, const __m128i b) noexcept {
+        return _mm_cmpeq_epi16(a, b);
+    }
+};
+
+template<>
+struct Sse2Lanes<4> {
+    template<class T>
+    static __m128i broadcast(const T value) noexcept {
+        return _mm_set1_epi32(static_cast<int>(value));
+    }
+
+    static __m128i compare(const __m128i a, const __m128i b) noexcept {
+        return _mm_cmpeq_epi32(a, b);
+    }
+};
+
+template<>
+struct Sse2Lanes<8> {
+    template<class T>
+    static __m128i broadcast(const T value) noexcept {
+        return _mm_set1_epi64x(static_cast<long long>(value));
+    }
+
+    // SSE2 has no 64 bit compare; a 64 bit lane is equal if both of its 32 bit halves are
+    static __m128i compare(const __m128i a, const __m128i b) noexcept {
+        const __m128i eq = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+};
+
+// Returns a 16 bit mask, with sizeof(T) bits set for every lane of [first, first + 16 / sizeof(T)) that equals `needle`
+template<class T>
+int compareBlock(const T* first, const __m128i needle) noexcept {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    return _mm_movemask_epi8(Sse2Lanes<sizeof(T)>::compare(block, needle));
+}
+#    endif // LZ_HAS_SSE2
+
+template<class T>
+const T* findContiguous(const T* first, const T* last, const T value) noexcept {
+    if LZ_CONSTEXPR_IF (sizeof(T) == 1) {
+        const void* pos = std::memchr(first, static_cast<unsigned char>(value), static_cast<std::size_t>(last - first));
+        return pos == nullptr ? last : static_cast<const T*>(pos);
+    }
+#    ifdef LZ_HAS_SSE2
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i needle = Sse2Lanes<sizeof(T)>::broadcast(value);
+    for (; last - first >= lanes; first += lanes) {
+        const int mask = compareBlock(first, needle);
+        if (mask != 0) {
+            return first + countTrailingZeros(static_cast<std::uint64_t>(mask)) / static_cast<int>(sizeof(T));
+        }
+    }
+#    endif // LZ_HAS_SSE2
+    for (; first != last; ++first) {
+        if (*first == value) {
+            return first;
+        }
+    }
+    return last;
+}
+
+template<class T>
+std::ptrdiff_t countContiguous(const T* first, const T* last, const T value) noexcept {
+    std::ptrdiff_t count = 0;
+#    ifdef LZ_HAS_SSE2
+    constexpr std::ptrdiff_t lanes = 16 / sizeof(T);
+    const __m128i needle = Sse2Lanes<sizeof(T)>::broadcast(value);
+    for (; last - first >= lanes; first += lanes) {
+        count += popCount(static_cast<unsigned int>(compareBlock(first, needle))) / static_cast<int>(sizeof(T));
+    }
+#    endif // LZ_HAS_SSE2
+    for (; first != last; ++first) {
+        count += *first == value;
+    }
+    return count;
+}
+
+// An integer value can only be equal to an element of type ValueType<Iterator> if it survives the round trip through that
+// type. In that case, comparing with the converted value gives the same result as comparing with the original value
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasFastFind<Iterator, T>::value, Iterator> findValue(Iterator first, Iterator last, const T& value) {
+    using V = ValueType<Iterator>;
+    const auto needle = static_cast<V>(value);
+    if (first == last || static_cast<T>(needle) != value) {
+        return last;
+    }
+    const V* begin = std::addressof(*first);
+    const V* pos = findContiguous(begin, begin + (last - first), needle);
+    return first + (pos - begin);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasFastFind<Iterator, T>::value, Iterator> findValue(Iterator first, Iterator last, const T& value) {
+    return std::find(std::move(first), std::move(last), value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasFastFind<Iterator, T>::value, DiffType<Iterator>>
+countValue(Iterator first, Iterator last, const T& value) {
+    using V = ValueType<Iterator>;
+    const auto needle = static_cast<V>(value);
+    if (first == last || static_cast<T>(needle) != value) {
+        return 0;
+    }
+    const V* begin = std::addressof(*first);
+    return static_cast<DiffType<Iterator>>(countContiguous(begin, begin + (last - first), needle));
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasFastFind<Iterator, T>::value, DiffType<Iterator>>
+countValue(Iterator first, Iterator last, const T& value) {
+    return std::count(std::move(first), std::move(last), value);
+}
+
+template<class IteratorA, class IteratorB>
+bool memEqual(const IteratorA a, const IteratorB b, const std::size_t count) {
+    if (count == 0) {
+        return true;
+    }
+    return std::memcmp(std::addressof(*a), std::addressof(*b), count * sizeof(ValueType<IteratorA>)) == 0;
+}
+
+// Checks whether [beginA, endA) and [beginB, endB) have the same length and elements
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeEqual(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate) {
+    const auto size = static_cast<std::size_t>(endA - beginA);
+    return size == static_cast<std::size_t>(endB - beginB) && memEqual(beginA, beginB, size);
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeEqual(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+    for (; beginA != endA && beginB != endB; ++beginA, ++beginB) {
+        if (!predicate(*beginA, *beginB)) {
+            return false;
+        }
+    }
+    return beginA == endA && beginB == endB;
+}
+
+// Checks whether [beginA, endA) starts with [beginB, endB)
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeStartsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate) {
+    const auto size = static_cast<std::size_t>(endB - beginB);
+    return size <= static_cast<std::size_t>(endA - beginA) && memEqual(beginA, beginB, size);
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeStartsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+    for (; beginB != endB; ++beginA, ++beginB) {
+        if (beginA == endA || !predicate(*beginA, *beginB)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Checks whether [beginA, endA) ends with [beginB, endB)
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeEndsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate) {
+    const auto sizeA = endA - beginA;
+    const auto sizeB = endB - beginB;
+    return sizeB <= sizeA && memEqual(endA - sizeB, beginB, static_cast<std::size_t>(sizeB));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasFastEqual<IteratorA, IteratorB, BinaryPredicate>::value, bool>
+rangeEndsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+    return rangeStartsWith(std::reverse_iterator<IteratorA>(std::move(endA)), std::reverse_iterator<IteratorA>(std::move(beginA)),
+                           std::reverse_iterator<IteratorB>(std::move(endB)), std::reverse_iterator<IteratorB>(std::move(beginB)),
+                           std::move(predicate));
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_ALGORITHM_HPP
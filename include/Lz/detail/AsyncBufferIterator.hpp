@@ -0,0 +1,195 @@
+#pragma once
+
+#ifndef LZ_ASYNC_BUFFER_ITERATOR_HPP
+#    define LZ_ASYNC_BUFFER_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+#    include "Optional.hpp"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <exception>
+#    include <memory>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The source is iterated over by a background thread, which is the only producer of a ring buffer of `capacity` elements. The
+// thread that iterates over the result is the only consumer. Both sides spin shortly before they block, and only notify the
+// other side if it is blocked, so no lock is taken as long as the buffer is neither empty nor full
+template<class Iterator>
+class AsyncBufferState {
+public:
+    using value_type = ValueType<Iterator>;
+
+private:
+    static constexpr int Spins = 64;
+
+    Iterator _iterator;
+    Iterator _end;
+    std::vector<Optional<value_type>> _slots;
+    // Both only ever increase. The element at `_head % capacity` is the current element if `_head != _tail`
+    std::atomic<std::size_t> _head{ 0 };
+    std::atomic<std::size_t> _tail{ 0 };
+    std::atomic<bool> _done{ false };
+    std::atomic<bool> _stop{ false };
+    std::exception_ptr _error{};
+
+    std::mutex _mutex{};
+    std::condition_variable _notEmpty{};
+    std::condition_variable _notFull{};
+    std::atomic<bool> _consumerWaiting{ false };
+    std::atomic<bool> _producerWaiting{ false };
+    std::thread _thread{};
+
+    template<class Predicate>
+    void wait(std::atomic<bool>& waiting, std::condition_variable& condition, Predicate predicate) {
+        for (int i = 0; i < Spins; ++i) {
+            if (predicate()) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(_mutex);
+        waiting = true;
+        condition.wait(lock, predicate);
+        waiting = false;
+    }
+
+    // The flag is set while the mutex is held, so if it is set, the other side either is waiting on the condition already, or
+    // will see the change before it starts to wait
+    void notify(const std::atomic<bool>& waiting, std::condition_variable& condition) {
+        if (waiting) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            condition.notify_one();
+        }
+    }
+
+    void produce() {
+        try {
+            for (; _iterator != _end; ++_iterator) {
+                const std::size_t tail = _tail.load(std::memory_order_relaxed);
+                wait(_producerWaiting, _notFull, [this, tail] { return _stop || tail - _head < _slots.size(); });
+                if (_stop) {
+                    break;
+                }
+                _slots[tail % _slots.size()] = *_iterator;
+                _tail = tail + 1;
+                notify(_consumerWaiting, _notEmpty);
+            }
+        }
+        catch (...) {
+            _error = std::current_exception();
+        }
+        _done = true;
+        notify(_consumerWaiting, _notEmpty);
+    }
+
+public:
+    AsyncBufferState(Iterator begin, Iterator end, const std::size_t capacity) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _slots(capacity) {
+        LZ_ASSERT(capacity != 0, "capacity must be greater than 0");
+    }
+
+    AsyncBufferState(const AsyncBufferState&) = delete;
+    AsyncBufferState& operator=(const AsyncBufferState&) = delete;
+
+    // The producer stops after the element it is currently evaluating, if the result is destroyed before the end is reached
+    ~AsyncBufferState() {
+        if (!_thread.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _notFull.notify_one();
+        _thread.join();
+    }
+
+    // Returns false if all elements have been consumed. Rethrows the exception that the source has thrown, once all elements
+    // before it have been consumed
+    bool fetch() {
+        if (!_thread.joinable()) {
+            _thread = std::thread(&AsyncBufferState::produce, this);
+        }
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        wait(_consumerWaiting, _notEmpty, [this, head] { return _tail != head || _done; });
+        if (_tail != head) {
+            return true;
+        }
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+        return false;
+    }
+
+    const value_type& current() {
+        fetch();
+        return *_slots[_head.load(std::memory_order_relaxed) % _slots.size()];
+    }
+
+    void next() {
+        fetch();
+        _head = _head.load(std::memory_order_relaxed) + 1;
+        notify(_producerWaiting, _notFull);
+    }
+};
+
+template<class Iterator>
+class AsyncBufferIterator {
+    using State = AsyncBufferState<Iterator>;
+
+    std::shared_ptr<State> _state{};
+
+    bool isEnd() const {
+        return !_state || !_state->fetch();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename State::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    explicit AsyncBufferIterator(std::shared_ptr<State> state) : _state(std::move(state)) {
+    }
+
+    AsyncBufferIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _state->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    AsyncBufferIterator& operator++() {
+        _state->next();
+        return *this;
+    }
+
+    PostIncrementProxy<value_type> operator++(int) {
+        PostIncrementProxy<value_type> tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const AsyncBufferIterator& a, const AsyncBufferIterator& b) {
+        return a.isEnd() != b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator==(const AsyncBufferIterator& a, const AsyncBufferIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_ASYNC_BUFFER_ITERATOR_HPP
@@ -3,6 +3,7 @@
 #ifndef LZ_BASIC_ITERATOR_VIEW_HPP
 #    define LZ_BASIC_ITERATOR_VIEW_HPP
 
+#    include "Algorithm.hpp"
 #    include "LzTools.hpp"
 
 #    include <algorithm>
@@ -212,6 +213,12 @@ struct HasReserve : std::false_type {};
 template<class T>
 struct HasReserve<T, decltype((void)std::declval<T&>().reserve(1), 0)> : std::true_type {};
 
+// Copying a view copies its iterators, and with them the functions that they hold (see FunctionContainer), so copies of the same
+// view (i.e. the parts returned by `lz::splitInto`) can be iterated over from different threads at once, even if the functions
+// have mutable state. A single iterator must not be used from several threads at once. This does not hold for the views of which
+// the copies share state: `lz::cache`, `lz::cacheLast` and `lz::random` with a user generator (which are therefore never split),
+// `lz::mapBatch`, `lz::tee`, `lz::asyncBuffer`, `lz::parallelMap`, `lz::fromCoroutine` and `lz::externalSort`. See
+// `Random::clone` and `lz::threadLocalRandom` for random views
 template<class It>
 class BasicIteratorView {
 protected:
@@ -661,7 +668,7 @@ view(Iterable&& iterable) {
 template<class IterableA, class IterableB,
          class BinaryPredicate = MAKE_BIN_OP(std::equal_to, internal::ValueTypeIterable<IterableA>)>
 bool equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}) {
-    return std::equal(std::begin(a), std::end(a), std::begin(b), std::move(predicate));
+    return internal::rangeEqual(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
 }
 #    else  // ^^^ !LZ_HAS_EXECUTION vvv LZ_HAS_EXECUTION
 /**
@@ -677,7 +684,7 @@ equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}, Ex
     if constexpr (internal::checkForwardAndPolicies<Execution, internal::IterTypeFromIterable<IterableA>>() &&
                   internal::checkForwardAndPolicies<Execution, internal::IterTypeFromIterable<IterableB>>()) {
         static_cast<void>(execution);
-        return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
+        return internal::rangeEqual(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
     else {
         return std::equal(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
@@ -0,0 +1,163 @@
+#pragma once
+
+#ifndef LZ_CACHE_ITERATOR_HPP
+#    define LZ_CACHE_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <deque>
+#    include <limits>
+#    include <memory>
+
+namespace lz {
+namespace internal {
+// Evaluates the underlying sequence at most once, on demand. The values are stored in a deque, which allocates in chunks and
+// never moves the values that were stored before, so references to them stay valid
+template<class Iterator>
+class CacheStorage {
+    using T = ValueType<Iterator>;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    std::deque<T> _values{};
+
+public:
+    CacheStorage(Iterator begin, Iterator end) : _iterator(std::move(begin)), _end(std::move(end)) {
+    }
+
+    // Evaluates the underlying sequence up to and including `index`. Returns false if it contains less elements
+    bool reach(const std::size_t index) {
+        for (; _values.size() <= index && _iterator != _end; ++_iterator) {
+            _values.push_back(*_iterator);
+        }
+        return index < _values.size();
+    }
+
+    const T& get(const std::size_t index) {
+        reach(index);
+        return _values[index];
+    }
+};
+
+template<class Iterator>
+class CacheIterator {
+    std::shared_ptr<CacheStorage<Iterator>> _storage{};
+    std::size_t _index{};
+
+public:
+    // The cache makes it possible to traverse input iterators more than once. The end of sequences that are not random access is
+    // not known up front, so they cannot be traversed backwards
+    using iterator_category = Conditional<IsRandomAccess<Iterator>::value, IterCat<Iterator>, std::forward_iterator_tag>;
+    using value_type = ValueType<Iterator>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = DiffType<Iterator>;
+
+    // The index of the end iterator of sequences of which the size is not known up front
+    static constexpr std::size_t unknownEnd() noexcept {
+        return (std::numeric_limits<std::size_t>::max)();
+    }
+
+    CacheIterator(std::shared_ptr<CacheStorage<Iterator>> storage, const std::size_t index) :
+        _storage(std::move(storage)),
+        _index(index) {
+    }
+
+    CacheIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _storage->get(_index);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    CacheIterator& operator++() {
+        ++_index;
+        return *this;
+    }
+
+    CacheIterator operator++(int) {
+        CacheIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    CacheIterator& operator--() {
+        --_index;
+        return *this;
+    }
+
+    CacheIterator operator--(int) {
+        CacheIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    CacheIterator& operator+=(const difference_type offset) {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + offset);
+        return *this;
+    }
+
+    CacheIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD CacheIterator operator+(const difference_type offset) const {
+        CacheIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD CacheIterator operator-(const difference_type offset) const {
+        CacheIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const CacheIterator& a, const CacheIterator& b) {
+        return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CacheIterator& a, const CacheIterator& b) {
+        if (a._index == b._index) {
+            return false;
+        }
+        if (a._index == unknownEnd()) {
+            return b._storage->reach(b._index);
+        }
+        if (b._index == unknownEnd()) {
+            return a._storage->reach(a._index);
+        }
+        return true;
+    }
+
+    LZ_NODISCARD friend bool operator==(const CacheIterator& a, const CacheIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const CacheIterator& a, const CacheIterator& b) {
+        return a._index < b._index;
+    }
+
+    LZ_NODISCARD friend bool operator>(const CacheIterator& a, const CacheIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const CacheIterator& a, const CacheIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const CacheIterator& a, const CacheIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CACHE_ITERATOR_HPP
@@ -0,0 +1,136 @@
+#pragma once
+
+#ifndef LZ_CACHE_LAST_ITERATOR_HPP
+#    define LZ_CACHE_LAST_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+#    include "Optional.hpp"
+
+#    include <memory>
+
+namespace lz {
+namespace internal {
+// The last evaluated element and its position. It is shared between the copies of an iterator, because algorithms such as
+// std::find_if evaluate their predicate on a copy
+template<class Iterator>
+struct LastValue {
+    Iterator position;
+    Optional<ValueType<Iterator>> value{};
+
+    explicit LastValue(Iterator iterator) : position(std::move(iterator)) {
+    }
+};
+
+// Stores the last dereferenced element, so that dereferencing the same position again does not evaluate it again
+template<class Iterator>
+class CacheLastIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = typename IterTraits::iterator_category;
+    using value_type = typename IterTraits::value_type;
+    // A copy is returned, the stored element is overwritten as soon as another position is dereferenced
+    using reference = value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename IterTraits::difference_type;
+
+private:
+    Iterator _iterator{};
+    std::shared_ptr<LastValue<Iterator>> _last{};
+
+public:
+    CacheLastIterator(Iterator iterator, std::shared_ptr<LastValue<Iterator>> last) :
+        _iterator(std::move(iterator)),
+        _last(std::move(last)) {
+    }
+
+    CacheLastIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        if (!_last->value || _last->position != _iterator) {
+            _last->value = *_iterator;
+            _last->position = _iterator;
+        }
+        return *_last->value;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    CacheLastIterator& operator++() {
+        ++_iterator;
+        return *this;
+    }
+
+    CacheLastIterator operator++(int) {
+        CacheLastIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    CacheLastIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    CacheLastIterator operator--(int) {
+        CacheLastIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    CacheLastIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        return *this;
+    }
+
+    CacheLastIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD CacheLastIterator operator+(const difference_type offset) const {
+        return CacheLastIterator(_iterator + offset, _last);
+    }
+
+    LZ_NODISCARD CacheLastIterator operator-(const difference_type offset) const {
+        return CacheLastIterator(_iterator - offset, _last);
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator==(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator>(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const CacheLastIterator& a, const CacheLastIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CACHE_LAST_ITERATOR_HPP
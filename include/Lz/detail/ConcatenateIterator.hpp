@@ -135,7 +135,8 @@ struct PlusIs {
 template<class Tuple, std::size_t I>
 struct PlusIs<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
     template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_14 void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
+    LZ_CONSTEXPR_CXX_14 void operator()(Tuple& iterators, const Tuple& /*end*/, const DifferenceType offset) const {
+        std::get<I>(iterators) += offset;
     }
 };
 #else
@@ -243,10 +244,8 @@ struct PlusIs {
     template<class DifferenceType>
     LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
         if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(iterators);
             static_cast<void>(end);
-            static_cast<void>(offset);
-            return;
+            std::get<I>(iterators) += offset;
         }
         else {
             using TupElem = TupleElement<I, Tuple>;
@@ -0,0 +1,228 @@
+#pragma once
+
+#ifndef LZ_EXPRESSION_ITERATOR_HPP
+#    define LZ_EXPRESSION_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <limits>
+
+namespace lz {
+namespace internal {
+// Iterator that repeats a single value endlessly. Used for the scalar operands of an expression. Because it never compares
+// equal, the other (non scalar) operands determine the end of the expression
+template<class T>
+class ScalarIterator {
+    T _value{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    constexpr explicit ScalarIterator(T value) : _value(std::move(value)) {
+    }
+
+    constexpr ScalarIterator() = default;
+
+    LZ_NODISCARD constexpr reference operator*() const noexcept {
+        return _value;
+    }
+
+    LZ_NODISCARD constexpr reference operator[](const difference_type) const noexcept {
+        return _value;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ScalarIterator& operator++() noexcept {
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ScalarIterator& operator--() noexcept {
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ScalarIterator& operator+=(const difference_type) noexcept {
+        return *this;
+    }
+
+    LZ_NODISCARD constexpr friend difference_type operator-(const ScalarIterator&, const ScalarIterator&) noexcept {
+        return (std::numeric_limits<difference_type>::max)();
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const ScalarIterator&, const ScalarIterator&) noexcept {
+        return false;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const ScalarIterator&, const ScalarIterator&) noexcept {
+        return true;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<(const ScalarIterator&, const ScalarIterator&) noexcept {
+        return false;
+    }
+};
+
+template<class Op, class... Iterators>
+class ExpressionIterator {
+    using CurrentCat = typename std::common_type<IterCat<Iterators>...>::type;
+
+public:
+    using iterator_category = CurrentCat;
+    using reference = decltype(std::declval<const Op&>()(*std::declval<Iterators>()...));
+    using value_type = Decay<reference>;
+    using difference_type = typename std::common_type<DiffType<Iterators>...>::type;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    using MakeIndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
+    std::tuple<Iterators...> _iterators{};
+    LZ_NO_UNIQUE_ADDRESS
+    Op _op{};
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 reference dereference(IndexSequence<I...>) const {
+        return _op(*std::get<I>(_iterators)...);
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 reference index(IndexSequence<I...>, const difference_type offset) const {
+        return _op(std::get<I>(_iterators)[static_cast<DiffType<Iterators>>(offset)]...);
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 void increment(IndexSequence<I...>) {
+        decompose((++std::get<I>(_iterators), 0)...);
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 void decrement(IndexSequence<I...>) {
+        decompose((--std::get<I>(_iterators), 0)...);
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 void plusIs(IndexSequence<I...>, const difference_type offset) {
+        decompose(((std::get<I>(_iterators) += static_cast<DiffType<Iterators>>(offset)), 0)...);
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 difference_type minus(const ExpressionIterator& other, IndexSequence<I...>) const {
+        const difference_type expand[] = { static_cast<difference_type>(std::get<I>(_iterators) -
+                                                                         std::get<I>(other._iterators))... };
+        return *std::min_element(std::begin(expand), std::end(expand));
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 bool eq(const ExpressionIterator& other, IndexSequence<I...>) const {
+        const bool expander[] = { (std::get<I>(_iterators) == std::get<I>(other._iterators))... };
+        const auto end = std::end(expander);
+        return std::find(std::begin(expander), end, true) != end;
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 bool lt(const ExpressionIterator& other, IndexSequence<I...>) const {
+        const bool expander[] = { (std::get<I>(_iterators) < std::get<I>(other._iterators))... };
+        const auto end = std::end(expander);
+        return std::find(std::begin(expander), end, true) != end;
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator(std::tuple<Iterators...> iterators, Op op) :
+        _iterators(std::move(iterators)),
+        _op(std::move(op)) {
+    }
+
+    constexpr ExpressionIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return dereference(MakeIndexSequenceForThis());
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator& operator++() {
+        increment(MakeIndexSequenceForThis());
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator operator++(int) {
+        ExpressionIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator& operator--() {
+        decrement(MakeIndexSequenceForThis());
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator operator--(int) {
+        ExpressionIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator& operator+=(const difference_type offset) {
+        plusIs(MakeIndexSequenceForThis(), offset);
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ExpressionIterator operator+(const difference_type offset) const {
+        ExpressionIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExpressionIterator& operator-=(const difference_type offset) {
+        plusIs(MakeIndexSequenceForThis(), -offset);
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ExpressionIterator operator-(const difference_type offset) const {
+        ExpressionIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ExpressionIterator& other) const {
+        return minus(other, MakeIndexSequenceForThis());
+    }
+
+    // Evaluates the expression at `offset` directly, without creating intermediate iterators. This is what the fused
+    // evaluation loops use
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return index(MakeIndexSequenceForThis(), offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return a.eq(b, MakeIndexSequenceForThis());
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return !(a == b);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return a.lt(b, MakeIndexSequenceForThis());
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ExpressionIterator& a, const ExpressionIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_EXPRESSION_ITERATOR_HPP
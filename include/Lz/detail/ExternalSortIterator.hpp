@@ -0,0 +1,366 @@
+#pragma once
+
+#ifndef LZ_EXTERNAL_SORT_ITERATOR_HPP
+#    define LZ_EXTERNAL_SORT_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstdio>
+#    include <functional>
+#    include <memory>
+#    include <random>
+#    include <string>
+#    include <system_error>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+[[noreturn]] inline void throwFileError(const char* message) {
+    throw std::system_error(errno, std::generic_category(), message);
+}
+
+// Reads `size` bytes of a run. Returns false if the run ends before the first byte, if `atBoundary` is true, i.e. if the bytes
+// start a new element. A read error, or a run that ends within an element, would otherwise silently drop the rest of the run,
+// so these throw
+inline bool readRun(std::FILE* file, void* data, const std::size_t size, const bool atBoundary) {
+    const std::size_t read = std::fread(data, 1, size, file);
+    if (read == size) {
+        return true;
+    }
+    if (std::ferror(file)) {
+        throwFileError("lz::externalSort: could not read from run file");
+    }
+    if (read == 0 && atBoundary && std::feof(file)) {
+        return false;
+    }
+    errno = EIO;
+    throwFileError("lz::externalSort: run file ends within an element");
+}
+
+// Writes values to and reads values from the run files. Trivially copyable types are stored as-is, strings are stored as their
+// length followed by their characters
+template<class T, class = void>
+struct RunSerializer {
+    static_assert(AlwaysFalse<T>::value, "externalSort only supports trivially copyable types and std::basic_string");
+};
+
+template<class T>
+struct RunSerializer<T, EnableIf<std::is_trivially_copyable<T>::value>> {
+    static std::size_t footprint(const T&) noexcept {
+        return sizeof(T);
+    }
+
+    static void write(std::FILE* file, const T& value) {
+        if (std::fwrite(std::addressof(value), sizeof(T), 1, file) != 1) {
+            throwFileError("lz::externalSort: could not write to run file");
+        }
+    }
+
+    static bool read(std::FILE* file, T& value) {
+        return readRun(file, std::addressof(value), sizeof(T), true);
+    }
+};
+
+template<class Char, class Traits, class Allocator>
+struct RunSerializer<std::basic_string<Char, Traits, Allocator>> {
+    using String = std::basic_string<Char, Traits, Allocator>;
+
+    static std::size_t footprint(const String& value) noexcept {
+        return sizeof(String) + value.size() * sizeof(Char);
+    }
+
+    static void write(std::FILE* file, const String& value) {
+        const std::size_t size = value.size();
+        if (std::fwrite(&size, sizeof(size), 1, file) != 1 ||
+            (size != 0 && std::fwrite(value.data(), sizeof(Char), size, file) != size)) {
+            throwFileError("lz::externalSort: could not write to run file");
+        }
+    }
+
+    static bool read(std::FILE* file, String& value) {
+        std::size_t size = 0;
+        if (!readRun(file, &size, sizeof(size), true)) {
+            return false;
+        }
+        value.resize(size);
+        return size == 0 || readRun(file, &value[0], size * sizeof(Char), false);
+    }
+};
+
+// A temporary file containing one sorted run. If no directory is given, std::tmpfile is used, which removes the file itself.
+// Otherwise the file is created exclusively under a random name, so that an existing file is never overwritten
+class RunFile {
+    static constexpr int MaxAttempts = 16;
+
+    std::FILE* _file{};
+    std::string _path{};
+
+public:
+    explicit RunFile(const std::string& directory) {
+        if (directory.empty()) {
+            _file = std::tmpfile();
+        }
+        else {
+            std::random_device device;
+            for (int attempt = 0; attempt < MaxAttempts && _file == nullptr; ++attempt) {
+                const auto name = (static_cast<unsigned long long>(device()) << 32) ^ device();
+                _path = directory + "/lz-external-sort-" + std::to_string(name) + ".run";
+                errno = 0;
+                _file = std::fopen(_path.c_str(), "w+bx");
+                if (_file == nullptr && errno != EEXIST) {
+                    break;
+                }
+            }
+        }
+        if (_file == nullptr) {
+            _path.clear();
+            throwFileError("lz::externalSort: could not create run file");
+        }
+    }
+
+    RunFile(RunFile&& other) noexcept : _file(other._file), _path(std::move(other._path)) {
+        other._file = nullptr;
+        other._path.clear();
+    }
+
+    RunFile& operator=(RunFile&& other) noexcept {
+        std::swap(_file, other._file);
+        std::swap(_path, other._path);
+        return *this;
+    }
+
+    RunFile(const RunFile&) = delete;
+    RunFile& operator=(const RunFile&) = delete;
+
+    ~RunFile() {
+        if (_file != nullptr) {
+            std::fclose(_file);
+        }
+        if (!_path.empty()) {
+            std::remove(_path.c_str());
+        }
+    }
+
+    std::FILE* get() const noexcept {
+        return _file;
+    }
+};
+
+// Splits the input into sorted runs that fit in the memory budget, and merges them lazily. The last run is never written to
+// disk. Equal elements keep their relative order, because the runs are sorted stably and ties are resolved in favour of the
+// earlier run. At most `MaxFanIn` runs are merged at once: runs are merged into larger runs in passes, like the digits of a
+// counter in base `MaxFanIn`, so that the amount of open files stays small for any input size
+template<class T, class Compare>
+class ExternalMerge {
+    using Serializer = RunSerializer<T>;
+
+public:
+    static constexpr std::size_t MaxFanIn = 16;
+
+private:
+    std::vector<RunFile> _files{};
+    // The amount of times the runs in `_files` have been merged. Never increases from the front to the back
+    std::vector<std::size_t> _levels{};
+    std::vector<T> _memoryRun{};
+    std::size_t _memoryIndex{};
+    // The current (smallest unread) element of every run. Run `_files.size()` is the memory run
+    std::vector<T> _heads{};
+    // Min heap of the runs that are not exhausted yet
+    std::vector<std::size_t> _heap{};
+    FunctionContainer<Compare> _compare;
+
+    bool heapCompare(const std::size_t a, const std::size_t b) {
+        if (_compare(_heads[b], _heads[a])) {
+            return true;
+        }
+        return !_compare(_heads[a], _heads[b]) && b < a;
+    }
+
+    void spill(std::vector<T>& buffer, const std::string& directory) {
+        std::stable_sort(buffer.begin(), buffer.end(), std::ref(_compare));
+        RunFile file(directory);
+        for (const T& value : buffer) {
+            Serializer::write(file.get(), value);
+        }
+        if (std::fflush(file.get()) != 0) {
+            throwFileError("lz::externalSort: could not write to run file");
+        }
+        std::rewind(file.get());
+        _files.push_back(std::move(file));
+        _levels.push_back(0);
+
+        while (_files.size() >= MaxFanIn && _levels[_files.size() - MaxFanIn] == _levels.back()) {
+            mergeLast(directory);
+        }
+    }
+
+    // Merges the last `MaxFanIn` runs on disk into one run
+    void mergeLast(const std::string& directory) {
+        const std::size_t first = _files.size() - MaxFanIn;
+        std::vector<T> heads(MaxFanIn);
+        std::vector<std::size_t> heap;
+        const auto compare = [this, &heads](const std::size_t a, const std::size_t b) {
+            if (_compare(heads[b], heads[a])) {
+                return true;
+            }
+            return !_compare(heads[a], heads[b]) && b < a;
+        };
+        for (std::size_t run = 0; run < MaxFanIn; ++run) {
+            if (Serializer::read(_files[first + run].get(), heads[run])) {
+                heap.push_back(run);
+                std::push_heap(heap.begin(), heap.end(), compare);
+            }
+        }
+
+        RunFile merged(directory);
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), compare);
+            const std::size_t run = heap.back();
+            Serializer::write(merged.get(), heads[run]);
+            if (Serializer::read(_files[first + run].get(), heads[run])) {
+                std::push_heap(heap.begin(), heap.end(), compare);
+            }
+            else {
+                heap.pop_back();
+            }
+        }
+        if (std::fflush(merged.get()) != 0) {
+            throwFileError("lz::externalSort: could not write to run file");
+        }
+        std::rewind(merged.get());
+
+        const std::size_t level = _levels.back() + 1;
+        _files.erase(_files.begin() + static_cast<std::ptrdiff_t>(first), _files.end());
+        _levels.erase(_levels.begin() + static_cast<std::ptrdiff_t>(first), _levels.end());
+        _files.push_back(std::move(merged));
+        _levels.push_back(level);
+    }
+
+    bool readNext(const std::size_t run) {
+        if (run < _files.size()) {
+            return Serializer::read(_files[run].get(), _heads[run]);
+        }
+        if (_memoryIndex == _memoryRun.size()) {
+            return false;
+        }
+        _heads[run] = std::move(_memoryRun[_memoryIndex++]);
+        return true;
+    }
+
+    void pushHeap() {
+        std::push_heap(_heap.begin(), _heap.end(), [this](const std::size_t a, const std::size_t b) { return heapCompare(a, b); });
+    }
+
+    void popHeap() {
+        std::pop_heap(_heap.begin(), _heap.end(), [this](const std::size_t a, const std::size_t b) { return heapCompare(a, b); });
+    }
+
+public:
+    template<class Iterator>
+    ExternalMerge(Iterator begin, Iterator end, Compare compare, const std::size_t memoryBudget, const std::string& directory) :
+        _compare(std::move(compare)) {
+        std::vector<T> buffer;
+        std::size_t used = 0;
+        for (; begin != end; ++begin) {
+            T value = *begin;
+            used += Serializer::footprint(value);
+            buffer.push_back(std::move(value));
+            if (used >= memoryBudget) {
+                spill(buffer, directory);
+                buffer.clear();
+                used = 0;
+            }
+        }
+        std::stable_sort(buffer.begin(), buffer.end(), std::ref(_compare));
+        _memoryRun = std::move(buffer);
+        // Leaves room for the memory run in the final merge
+        while (_files.size() >= MaxFanIn) {
+            mergeLast(directory);
+        }
+
+        _heads.resize(_files.size() + 1);
+        for (std::size_t run = 0; run < _heads.size(); ++run) {
+            if (readNext(run)) {
+                _heap.push_back(run);
+                pushHeap();
+            }
+        }
+    }
+
+    std::size_t runs() const noexcept {
+        return _heads.size();
+    }
+
+    bool empty() const noexcept {
+        return _heap.empty();
+    }
+
+    const T& current() const {
+        return _heads[_heap.front()];
+    }
+
+    void advance() {
+        popHeap();
+        if (readNext(_heap.back())) {
+            pushHeap();
+        }
+        else {
+            _heap.pop_back();
+        }
+    }
+};
+
+template<class T, class Compare>
+class ExternalSortIterator {
+    std::shared_ptr<ExternalMerge<T, Compare>> _merge{};
+
+    bool isEnd() const noexcept {
+        return !_merge || _merge->empty();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    explicit ExternalSortIterator(std::shared_ptr<ExternalMerge<T, Compare>> merge) : _merge(std::move(merge)) {
+    }
+
+    ExternalSortIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _merge->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    ExternalSortIterator& operator++() {
+        _merge->advance();
+        return *this;
+    }
+
+    PostIncrementProxy<T> operator++(int) {
+        PostIncrementProxy<T> tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ExternalSortIterator& a, const ExternalSortIterator& b) noexcept {
+        return a.isEnd() != b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator==(const ExternalSortIterator& a, const ExternalSortIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_EXTERNAL_SORT_ITERATOR_HPP
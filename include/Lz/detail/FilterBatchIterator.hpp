@@ -0,0 +1,145 @@
+#pragma once
+
+#ifndef LZ_FILTER_BATCH_ITERATOR_HPP
+#    define LZ_FILTER_BATCH_ITERATOR_HPP
+
+#    include "Algorithm.hpp"
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <array>
+#    include <cstdint>
+#    include <memory>
+
+namespace lz {
+namespace internal {
+template<class Iterator, class BatchPredicate>
+class FilterBatchIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    // The amount of elements the predicate receives at once, one bit per element in the returned mask
+    static constexpr std::size_t blockSize = 64;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    // Remaining selected elements of the current block, bit i corresponds to block element i
+    std::uint64_t _mask{};
+    // Offset of _iterator relative to the start of the current block
+    std::size_t _index{};
+    // Amount of elements in the current block
+    std::size_t _count{};
+    using Block = std::array<value_type, blockSize>;
+
+    // Only used if Iterator is not contiguous; the block is copied here before it is passed to the predicate. If the source
+    // returns its elements by value (i.e. lz::map), they are also returned from here, so that every element is evaluated once.
+    // Copies of the iterator share the block, an iterator that evaluates the next block while its block is shared allocates a
+    // new one
+    std::shared_ptr<Block> _buffer{};
+    mutable FunctionContainer<BatchPredicate> _predicate{};
+
+    static constexpr std::uint64_t lowMask(const std::size_t count) noexcept {
+        return count >= blockSize ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << count) - 1;
+    }
+
+    template<class I = Iterator>
+    EnableIf<IsContiguous<I>::value, std::uint64_t> evaluateBlock() {
+        _count = static_cast<std::size_t>(_end - _iterator);
+        if (_count > blockSize) {
+            _count = blockSize;
+        }
+        const value_type* data = std::addressof(*_iterator);
+        return static_cast<std::uint64_t>(_predicate(data, _count)) & lowMask(_count);
+    }
+
+    template<class I = Iterator>
+    EnableIf<!IsContiguous<I>::value, std::uint64_t> evaluateBlock() {
+        if (_buffer.use_count() != 1) {
+            _buffer = std::make_shared<Block>();
+        }
+        _count = 0;
+        for (Iterator it = _iterator; _count < blockSize && it != _end; ++it) {
+            (*_buffer)[_count++] = *it;
+        }
+        const value_type* data = _buffer->data();
+        return static_cast<std::uint64_t>(_predicate(data, _count)) & lowMask(_count);
+    }
+
+    template<class I = Iterator>
+    LZ_CONSTEXPR_CXX_20 EnableIf<IsContiguous<I>::value || std::is_reference<reference>::value, reference> dereference() const {
+        return *_iterator;
+    }
+
+    template<class I = Iterator>
+    LZ_CONSTEXPR_CXX_20 EnableIf<!IsContiguous<I>::value && !std::is_reference<reference>::value, reference> dereference() const {
+        return (*_buffer)[_index];
+    }
+
+    LZ_CONSTEXPR_CXX_20 void nextBlock() {
+        while (_iterator != _end) {
+            _mask = evaluateBlock();
+            if (_mask != 0) {
+                _index = static_cast<std::size_t>(countTrailingZeros(_mask));
+                std::advance(_iterator, static_cast<difference_type>(_index));
+                return;
+            }
+            std::advance(_iterator, static_cast<difference_type>(_count));
+        }
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 FilterBatchIterator(Iterator iterator, Iterator end, BatchPredicate predicate) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _predicate(std::move(predicate)) {
+        nextBlock();
+    }
+
+    constexpr FilterBatchIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return dereference();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterBatchIterator& operator++() {
+        _mask &= _mask - 1;
+        if (_mask != 0) {
+            const auto next = static_cast<std::size_t>(countTrailingZeros(_mask));
+            std::advance(_iterator, static_cast<difference_type>(next - _index));
+            _index = next;
+            return *this;
+        }
+        std::advance(_iterator, static_cast<difference_type>(_count - _index));
+        nextBlock();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterBatchIterator operator++(int) {
+        FilterBatchIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const FilterBatchIterator& a, const FilterBatchIterator& b) {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const FilterBatchIterator& a, const FilterBatchIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_FILTER_BATCH_ITERATOR_HPP
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef LZ_FILTER_MAP_OPT_ITERATOR_HPP
+#    define LZ_FILTER_MAP_OPT_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+// Calls the function once per element and keeps its (optional-like) result, which is skipped if it does not contain a value
+template<class Iterator, class Function>
+class FilterMapOptIterator {
+    using Result = Decay<FunctionReturnType<Function&, RefType<Iterator>>>;
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, IterCat<Iterator>>::type;
+    using value_type = Decay<decltype(*std::declval<const Result&>())>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = DiffType<Iterator>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    Result _current{};
+    mutable FunctionContainer<Function> _function{};
+
+    LZ_CONSTEXPR_CXX_20 void find() {
+        for (; _iterator != _end; ++_iterator) {
+            _current = _function(*_iterator);
+            if (_current) {
+                return;
+            }
+        }
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 FilterMapOptIterator(Iterator iterator, Iterator end, Function function) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _function(std::move(function)) {
+        find();
+    }
+
+    constexpr FilterMapOptIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return *_current;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterMapOptIterator& operator++() {
+        ++_iterator;
+        find();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterMapOptIterator operator++(int) {
+        FilterMapOptIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const FilterMapOptIterator& a, const FilterMapOptIterator& b) {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const FilterMapOptIterator& a, const FilterMapOptIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_FILTER_MAP_OPT_ITERATOR_HPP
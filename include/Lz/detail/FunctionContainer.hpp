@@ -9,6 +9,9 @@
 
 namespace lz {
 namespace internal {
+// Every iterator holds its own copy of the function, so copies of an iterator can be used from different threads at once, as
+// long as the function does not share its state between its copies (i.e. by capturing a reference). The function is mutable
+// because it is called from const member functions, so one iterator must not be used from several threads at once
 template<class Func>
 class FunctionContainer {
     mutable Func _func;
@@ -0,0 +1,191 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_ITERATOR_HPP
+#    define LZ_GENERATOR_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    ifdef LZ_HAS_COROUTINES
+
+#        include <coroutine>
+#        include <cstring>
+#        include <exception>
+#        include <memory>
+#        include <memory_resource>
+#        include <utility>
+
+namespace lz {
+
+LZ_MODULE_EXPORT_SCOPE_BEGIN
+
+template<class T>
+class Generator;
+
+LZ_MODULE_EXPORT_SCOPE_END
+
+namespace internal {
+// Every frame is followed by a pointer to the memory resource that allocated it, so that `operator delete` can return it to
+// the same resource
+inline std::size_t frameOffset(const std::size_t size) noexcept {
+    constexpr std::size_t alignment = alignof(std::pmr::memory_resource*);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+inline void* allocateFrame(const std::size_t size, std::pmr::memory_resource* resource) {
+    const std::size_t offset = frameOffset(size);
+    void* frame = resource->allocate(offset + sizeof(resource), alignof(std::max_align_t));
+    std::memcpy(static_cast<char*>(frame) + offset, &resource, sizeof(resource));
+    return frame;
+}
+
+inline void deallocateFrame(void* frame, const std::size_t size) noexcept {
+    const std::size_t offset = frameOffset(size);
+    std::pmr::memory_resource* resource = nullptr;
+    std::memcpy(&resource, static_cast<const char*>(frame) + offset, sizeof(resource));
+    resource->deallocate(frame, offset + sizeof(resource), alignof(std::max_align_t));
+}
+
+template<class T>
+class GeneratorPromise {
+    const T* _value{};
+    std::exception_ptr _error{};
+    bool _started{ false };
+
+public:
+    Generator<T> get_return_object() noexcept {
+        return Generator<T>(std::coroutine_handle<GeneratorPromise>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_always final_suspend() const noexcept {
+        return {};
+    }
+
+    // The yielded value lives until the coroutine is resumed, so it does not have to be copied
+    std::suspend_always yield_value(const T& value) noexcept {
+        _value = std::addressof(value);
+        return {};
+    }
+
+    void return_void() const noexcept {
+    }
+
+    void unhandled_exception() noexcept {
+        _error = std::current_exception();
+    }
+
+    template<class U>
+    std::suspend_never await_transform(U&&) = delete;
+
+    static void* operator new(const std::size_t size) {
+        return allocateFrame(size, std::pmr::get_default_resource());
+    }
+
+    // Used if the coroutine takes `(std::allocator_arg_t, std::pmr::memory_resource*, ...)`
+    template<class... Args>
+    static void* operator new(const std::size_t size, std::allocator_arg_t, std::pmr::memory_resource* resource, Args&...) {
+        return allocateFrame(size, resource);
+    }
+
+    // Used if the coroutine is a member function (i.e. the call operator of a lambda) that takes the same
+    template<class Class, class... Args>
+    static void*
+    operator new(const std::size_t size, Class&, std::allocator_arg_t, std::pmr::memory_resource* resource, Args&...) {
+        return allocateFrame(size, resource);
+    }
+
+    static void operator delete(void* frame, const std::size_t size) noexcept {
+        deallocateFrame(frame, size);
+    }
+
+    const T& value() const noexcept {
+        return *_value;
+    }
+
+    // Runs the coroutine until the first element, if it has not been started yet
+    void start() {
+        if (!_started) {
+            next();
+        }
+    }
+
+    void next() {
+        _started = true;
+        std::coroutine_handle<GeneratorPromise>::from_promise(*this).resume();
+        if (_error) {
+            std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+    }
+};
+
+template<class T>
+class GeneratorIterator {
+    using Handle = std::coroutine_handle<GeneratorPromise<T>>;
+
+    Handle _handle{};
+    // Keeps the coroutine alive if the iterator belongs to a view that owns it (see `lz::fromCoroutine`)
+    std::shared_ptr<void> _owner{};
+
+    bool isEnd() const {
+        if (!_handle) {
+            return true;
+        }
+        _handle.promise().start();
+        return _handle.done();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    explicit GeneratorIterator(const Handle handle) noexcept : _handle(handle) {
+    }
+
+    GeneratorIterator(const GeneratorIterator& other, std::shared_ptr<void> owner) noexcept :
+        _handle(other._handle),
+        _owner(std::move(owner)) {
+    }
+
+    GeneratorIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _handle.promise().start();
+        return _handle.promise().value();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    GeneratorIterator& operator++() {
+        _handle.promise().start();
+        _handle.promise().next();
+        return *this;
+    }
+
+    PostIncrementProxy<value_type> operator++(int) {
+        PostIncrementProxy<value_type> tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const GeneratorIterator& a, const GeneratorIterator& b) {
+        return a.isEnd() != b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator==(const GeneratorIterator& a, const GeneratorIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#    endif // LZ_HAS_COROUTINES
+
+#endif // LZ_GENERATOR_ITERATOR_HPP
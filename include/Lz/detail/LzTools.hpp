@@ -3,6 +3,7 @@
 #ifndef LZ_LZ_TOOLS_HPP
 #    define LZ_LZ_TOOLS_HPP
 
+#    include <cstdint>
 #    include <iterator>
 #    include <tuple>
 
@@ -83,6 +84,11 @@
 #        include <concepts>
 #    endif // Have concepts
 
+#    if LZ_HAS_INCLUDE(<coroutine>) && LZ_HAS_INCLUDE(<memory_resource>) && defined(LZ_HAS_CXX_20) &&                            \
+        defined(__cpp_impl_coroutine)
+#        define LZ_HAS_COROUTINES
+#    endif // has coroutines
+
 #    ifdef __cpp_if_constexpr
 #        define LZ_CONSTEXPR_IF constexpr
 #    else
@@ -172,6 +178,10 @@ LZ_MODULE_EXPORT_SCOPE_END
 #        include <stacktrace>
 #    endif
 
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#    endif // _MSC_VER
+
 namespace lz {
 namespace internal {
 
@@ -377,6 +387,21 @@ public:
     }
 };
 
+// Returned by the postfix increment of single pass iterators. Incrementing such an iterator may overwrite or release the
+// element it pointed to, so the element is copied to keep `*it++` valid
+template<class T>
+class PostIncrementProxy {
+    T _value;
+
+public:
+    explicit PostIncrementProxy(const T& value) : _value(value) {
+    }
+
+    const T& operator*() const noexcept {
+        return _value;
+    }
+};
+
 template<class>
 class FunctionContainer;
 
@@ -411,7 +436,10 @@ LZ_CONSTEXPR_CXX_14 void decompose(const Ts&...) noexcept {
 
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 LZ_CONSTEXPR_CXX_14 Arithmetic roundEven(const Arithmetic a, const Arithmetic b) noexcept {
-    LZ_ASSERT(a != 0 && b != 0, "division by zero error");
+    LZ_ASSERT(b != 0, "division by zero error");
+    if (a == 0) {
+        return 0;
+    }
     if (b == 1) {
         return a;
     }
@@ -434,6 +462,24 @@ DiffType<Iter> sizeHint(Iter first, Iter last) {
     }
 }
 
+// Returns the index of the lowest set bit. `value` must not be 0
+inline int countTrailingZeros(const std::uint64_t value) noexcept {
+    LZ_ASSERT(value != 0, "cannot count trailing zeros of 0");
+#    if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#    elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index = 0;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#    else
+    int count = 0;
+    for (std::uint64_t v = value; (v & 1) == 0; v >>= 1) {
+        ++count;
+    }
+    return count;
+#    endif
+}
+
 #    if defined(LZ_STANDALONE) && (!defined(LZ_HAS_FORMAT))
 
 constexpr char to_string(const char c) noexcept {
@@ -0,0 +1,133 @@
+#pragma once
+
+#ifndef LZ_MAP_BATCH_ITERATOR_HPP
+#    define LZ_MAP_BATCH_ITERATOR_HPP
+
+#    include "Algorithm.hpp"
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The transformed block, which is shared between copies of an iterator, so that copying an iterator does not copy or transform
+// the block again
+template<class Iterator, class InValueType, class T>
+struct MapBatchBlock {
+    // The beginning of the block that `out` holds
+    Iterator begin{};
+    bool loaded{ false };
+    // Only used if Iterator is not contiguous; the block is copied here before it is passed to the function
+    std::vector<InValueType> in{};
+    std::vector<T> out{};
+};
+
+template<class Iterator, class BatchFunction, class T>
+class MapBatchIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using InValueType = typename IterTraits::value_type;
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = T;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = value_type;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    // Beginning of the block that _iterator is in
+    Iterator _blockBegin{};
+    Iterator _iterator{};
+    Iterator _end{};
+    // Offset of _iterator relative to _blockBegin
+    std::size_t _index{};
+    std::size_t _blockSize{};
+    // The block is only transformed once one of its elements is dereferenced. It is created by the first dereference, and shared
+    // by the copies of the iterator that are made after that, which transform it again if they dereference another block. Copies
+    // that are made before (i.e. the ones returned by `begin()`) therefore do not share their block
+    mutable std::shared_ptr<MapBatchBlock<Iterator, InValueType, value_type>> _block{};
+    mutable FunctionContainer<BatchFunction> _function{};
+
+    template<class I = Iterator>
+    EnableIf<IsContiguous<I>::value> load() const {
+        auto count = static_cast<std::size_t>(_end - _blockBegin);
+        if (count > _blockSize) {
+            count = _blockSize;
+        }
+        const InValueType* in = std::addressof(*_blockBegin);
+        _function(in, _block->out.data(), count);
+    }
+
+    template<class I = Iterator>
+    EnableIf<!IsContiguous<I>::value> load() const {
+        std::vector<InValueType>& buffer = _block->in;
+        buffer.clear();
+        for (Iterator it = _blockBegin; buffer.size() < _blockSize && it != _end; ++it) {
+            buffer.push_back(*it);
+        }
+        const InValueType* in = buffer.data();
+        _function(in, _block->out.data(), buffer.size());
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 MapBatchIterator(Iterator iterator, Iterator end, BatchFunction function, const std::size_t blockSize) :
+        _blockBegin(iterator),
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _blockSize(blockSize),
+        _function(std::move(function)) {
+        LZ_ASSERT(blockSize != 0, "block size cannot be 0");
+    }
+
+    constexpr MapBatchIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        if (!_block) {
+            _block = std::make_shared<MapBatchBlock<Iterator, InValueType, value_type>>();
+            _block->out.resize(_blockSize);
+            if LZ_CONSTEXPR_IF (!IsContiguous<Iterator>::value) {
+                _block->in.reserve(_blockSize);
+            }
+        }
+        if (!_block->loaded || _block->begin != _blockBegin) {
+            load();
+            _block->begin = _blockBegin;
+            _block->loaded = true;
+        }
+        return _block->out[_index];
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapBatchIterator& operator++() {
+        ++_iterator;
+        ++_index;
+        if (_index == _blockSize) {
+            _blockBegin = _iterator;
+            _index = 0;
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapBatchIterator operator++(int) {
+        MapBatchIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const MapBatchIterator& a, const MapBatchIterator& b) {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const MapBatchIterator& a, const MapBatchIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_MAP_BATCH_ITERATOR_HPP
@@ -0,0 +1,277 @@
+#pragma once
+
+#ifndef LZ_MERGE_SORTED_ITERATOR_HPP
+#    define LZ_MERGE_SORTED_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Tournament tree of which every internal node contains the loser of the match played at that node, and `_tree[0]` the
+// overall winner. The leaves (the sources) are implicit at positions [k, 2k). After the winner has advanced, only the matches
+// on the path from its leaf to the root have to be replayed, which takes log(k) comparisons
+class LoserTree {
+    std::vector<std::size_t> _tree{};
+
+public:
+    // `beats(a, b)` must return true if the current element of source `a` should come before the one of source `b`
+    template<class Beats>
+    void build(const std::size_t k, Beats beats) {
+        _tree.assign(k, 0);
+        if (k == 0) {
+            return;
+        }
+        std::vector<std::size_t> winners(2 * k);
+        for (std::size_t i = 0; i < k; ++i) {
+            winners[k + i] = i;
+        }
+        for (std::size_t node = k - 1; node > 0; --node) {
+            std::size_t winner = winners[2 * node];
+            std::size_t loser = winners[2 * node + 1];
+            if (beats(loser, winner)) {
+                std::swap(winner, loser);
+            }
+            winners[node] = winner;
+            _tree[node] = loser;
+        }
+        _tree[0] = winners[1];
+    }
+
+    template<class Beats>
+    void replay(Beats beats) {
+        const std::size_t k = _tree.size();
+        std::size_t winner = _tree[0];
+        for (std::size_t node = (winner + k) / 2; node > 0; node /= 2) {
+            if (beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+
+    std::size_t winner() const noexcept {
+        return _tree[0];
+    }
+
+    std::size_t size() const noexcept {
+        return _tree.size();
+    }
+};
+
+// Sources of a merge with a fixed amount of (possibly different) iterator types. Sources are accessed by index, through a
+// table of functions
+template<class... Iterators>
+class TupleSources {
+    using First = typename std::tuple_element<0, std::tuple<Iterators...>>::type;
+    using Tuple = std::tuple<Iterators...>;
+
+public:
+    using reference = Conditional<IsAllSame<RefType<First>, RefType<Iterators>...>::value, RefType<First>,
+                                  typename std::common_type<RefType<Iterators>...>::type>;
+    using value_type = Decay<reference>;
+
+private:
+    using MakeIndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
+
+    Tuple _iterators{};
+    Tuple _ends{};
+
+    template<std::size_t I>
+    static reference derefAt(const TupleSources& sources) {
+        return *std::get<I>(sources._iterators);
+    }
+
+    template<std::size_t I>
+    static bool exhaustedAt(const TupleSources& sources) {
+        return std::get<I>(sources._iterators) == std::get<I>(sources._ends);
+    }
+
+    template<std::size_t I>
+    static void nextAt(TupleSources& sources) {
+        ++std::get<I>(sources._iterators);
+    }
+
+    template<std::size_t... I>
+    reference deref(const std::size_t source, IndexSequence<I...>) const {
+        using Function = reference (*)(const TupleSources&);
+        static const Function table[] = { &derefAt<I>... };
+        return table[source](*this);
+    }
+
+    template<std::size_t... I>
+    bool exhausted(const std::size_t source, IndexSequence<I...>) const {
+        using Function = bool (*)(const TupleSources&);
+        static const Function table[] = { &exhaustedAt<I>... };
+        return table[source](*this);
+    }
+
+    template<std::size_t... I>
+    void next(const std::size_t source, IndexSequence<I...>) {
+        using Function = void (*)(TupleSources&);
+        static const Function table[] = { &nextAt<I>... };
+        table[source](*this);
+    }
+
+public:
+    TupleSources(Tuple iterators, Tuple ends) : _iterators(std::move(iterators)), _ends(std::move(ends)) {
+    }
+
+    TupleSources() = default;
+
+    static constexpr std::size_t size() noexcept {
+        return sizeof...(Iterators);
+    }
+
+    reference deref(const std::size_t source) const {
+        return deref(source, MakeIndexSequenceForThis());
+    }
+
+    bool exhausted(const std::size_t source) const {
+        return exhausted(source, MakeIndexSequenceForThis());
+    }
+
+    void next(const std::size_t source) {
+        next(source, MakeIndexSequenceForThis());
+    }
+
+    friend bool operator==(const TupleSources& a, const TupleSources& b) {
+        return a._iterators == b._iterators;
+    }
+};
+
+// Sources of a merge with an amount of sources that is only known at runtime. All sources have the same iterator type
+template<class Iterator>
+class VectorSources {
+public:
+    using reference = RefType<Iterator>;
+    using value_type = ValueType<Iterator>;
+
+private:
+    std::vector<Iterator> _iterators{};
+    std::shared_ptr<const std::vector<Iterator>> _ends{};
+
+public:
+    VectorSources(std::vector<Iterator> iterators, std::shared_ptr<const std::vector<Iterator>> ends) :
+        _iterators(std::move(iterators)),
+        _ends(std::move(ends)) {
+    }
+
+    VectorSources() = default;
+
+    std::size_t size() const noexcept {
+        return _iterators.size();
+    }
+
+    reference deref(const std::size_t source) const {
+        return *_iterators[source];
+    }
+
+    bool exhausted(const std::size_t source) const {
+        return _iterators[source] == (*_ends)[source];
+    }
+
+    void next(const std::size_t source) {
+        ++_iterators[source];
+    }
+
+    friend bool operator==(const VectorSources& a, const VectorSources& b) {
+        return a._iterators == b._iterators;
+    }
+};
+
+template<class Sources, class Compare, bool Unique>
+class MergeSortedIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename Sources::value_type;
+    using reference = typename Sources::reference;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    Sources _sources{};
+    LoserTree _tree{};
+    mutable FunctionContainer<Compare> _compare{};
+
+    // Exhausted sources lose every match. Equal elements are taken from the first source first, which makes the merge stable
+    bool beats(const std::size_t a, const std::size_t b) const {
+        if (_sources.exhausted(a)) {
+            return false;
+        }
+        if (_sources.exhausted(b)) {
+            return true;
+        }
+        reference first = _sources.deref(a);
+        reference second = _sources.deref(b);
+        if (_compare(second, first)) {
+            return false;
+        }
+        return _compare(first, second) || a < b;
+    }
+
+    bool isEnd() const {
+        return _tree.size() == 0 || _sources.exhausted(_tree.winner());
+    }
+
+    void step() {
+        _sources.next(_tree.winner());
+        _tree.replay([this](const std::size_t a, const std::size_t b) { return beats(a, b); });
+    }
+
+public:
+    MergeSortedIterator(Sources sources, Compare compare) : _sources(std::move(sources)), _compare(std::move(compare)) {
+        _tree.build(_sources.size(), [this](const std::size_t a, const std::size_t b) { return beats(a, b); });
+    }
+
+    MergeSortedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _sources.deref(_tree.winner());
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    MergeSortedIterator& operator++() {
+        if LZ_CONSTEXPR_IF (Unique) {
+            const value_type last = **this;
+            step();
+            while (!isEnd() && !_compare(last, **this)) {
+                step();
+            }
+        }
+        else {
+            step();
+        }
+        return *this;
+    }
+
+    MergeSortedIterator operator++(int) {
+        MergeSortedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    // Checking whether the winner is exhausted is O(1), comparing all sources is only necessary if neither is at the end
+    LZ_NODISCARD friend bool operator==(const MergeSortedIterator& a, const MergeSortedIterator& b) {
+        const bool aIsEnd = a.isEnd();
+        const bool bIsEnd = b.isEnd();
+        if (aIsEnd || bIsEnd) {
+            return aIsEnd == bIsEnd;
+        }
+        return a._sources == b._sources;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const MergeSortedIterator& a, const MergeSortedIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_MERGE_SORTED_ITERATOR_HPP
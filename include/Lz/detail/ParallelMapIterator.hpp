@@ -0,0 +1,190 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_ITERATOR_HPP
+#    define LZ_PARALLEL_MAP_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+#    include "Optional.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <deque>
+#    include <exception>
+#    include <memory>
+
+namespace lz {
+namespace internal {
+template<class Iterator, class Function>
+using ParallelMapResult = Decay<FunctionReturnType<const FunctionContainer<Function>&, ValueType<Iterator>&>>;
+
+// Elements are taken from the source by the consuming thread, and mapped by the workers of the pool (i.e. lz::ThreadPool). At
+// most `window` elements are being mapped, or have been mapped but not consumed yet, at any time. If `Ordered` is true, the
+// results are consumed in the order of the source. Otherwise, the result that is ready first is consumed first
+template<class Iterator, class Function, class Pool, bool Ordered>
+class ParallelMapPipeline {
+public:
+    using Result = ParallelMapResult<Iterator, Function>;
+
+private:
+    struct Slot {
+        Optional<Result> result{};
+        std::exception_ptr error{};
+        std::atomic<bool> ready{ false };
+    };
+
+    struct MapTask {
+        const ParallelMapPipeline* pipeline;
+        Slot* slot;
+        ValueType<Iterator> value;
+
+        void operator()() {
+            try {
+                slot->result = pipeline->_function(value);
+            }
+            catch (...) {
+                slot->error = std::current_exception();
+            }
+            slot->ready = true;
+        }
+    };
+
+    Iterator _iterator;
+    Iterator _end;
+    FunctionContainer<Function> _function;
+    Pool* _pool;
+    std::size_t _window;
+    // The slot at the front is the current element, once it has been fetched
+    std::deque<std::unique_ptr<Slot>> _slots{};
+    bool _fetched{ false };
+
+    void fill() {
+        while (_slots.size() < _window && _iterator != _end) {
+            std::unique_ptr<Slot> slot(new Slot());
+            MapTask task{ this, slot.get(), *_iterator };
+            ++_iterator;
+            _slots.push_back(std::move(slot));
+            _pool->submit(std::move(task));
+        }
+    }
+
+    void waitFor(const Slot& slot) {
+        _pool->waitUntil([&slot] { return slot.ready.load(); });
+    }
+
+    // Moves the first slot that is ready to the front
+    void waitForAny() {
+        const auto isReady = [](const std::unique_ptr<Slot>& slot) {
+            return slot->ready.load();
+        };
+        _pool->waitUntil([this, &isReady] { return std::any_of(_slots.begin(), _slots.end(), isReady); });
+        std::swap(*std::find_if(_slots.begin(), _slots.end(), isReady), _slots.front());
+    }
+
+public:
+    ParallelMapPipeline(Iterator begin, Iterator end, Function function, Pool& pool, const std::size_t window) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _function(std::move(function)),
+        _pool(&pool),
+        _window(window == 0 ? 2 * pool.size() : window) {
+    }
+
+    ParallelMapPipeline(const ParallelMapPipeline&) = delete;
+    ParallelMapPipeline& operator=(const ParallelMapPipeline&) = delete;
+
+    // The tasks refer to this pipeline, so the elements that are still being mapped must be finished first
+    ~ParallelMapPipeline() {
+        for (const std::unique_ptr<Slot>& slot : _slots) {
+            waitFor(*slot);
+        }
+    }
+
+    // Returns false if all elements have been consumed. Rethrows the exception that the function has thrown for the current
+    // element, if any
+    bool fetch() {
+        if (_fetched) {
+            return true;
+        }
+        fill();
+        if (_slots.empty()) {
+            return false;
+        }
+        if LZ_CONSTEXPR_IF (Ordered) {
+            waitFor(*_slots.front());
+        }
+        else {
+            waitForAny();
+        }
+        _fetched = true;
+        if (_slots.front()->error) {
+            std::rethrow_exception(_slots.front()->error);
+        }
+        return true;
+    }
+
+    const Result& current() {
+        fetch();
+        return *_slots.front()->result;
+    }
+
+    void next() {
+        fetch();
+        _slots.pop_front();
+        _fetched = false;
+    }
+};
+
+template<class Iterator, class Function, class Pool, bool Ordered>
+class ParallelMapIterator {
+    using Pipeline = ParallelMapPipeline<Iterator, Function, Pool, Ordered>;
+
+    std::shared_ptr<Pipeline> _pipeline{};
+
+    bool isEnd() const {
+        return !_pipeline || !_pipeline->fetch();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename Pipeline::Result;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    explicit ParallelMapIterator(std::shared_ptr<Pipeline> pipeline) : _pipeline(std::move(pipeline)) {
+    }
+
+    ParallelMapIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _pipeline->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    ParallelMapIterator& operator++() {
+        _pipeline->next();
+        return *this;
+    }
+
+    PostIncrementProxy<value_type> operator++(int) {
+        PostIncrementProxy<value_type> tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ParallelMapIterator& a, const ParallelMapIterator& b) {
+        return a.isEnd() != b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator==(const ParallelMapIterator& a, const ParallelMapIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_ITERATOR_HPP
@@ -0,0 +1,298 @@
+#pragma once
+
+#ifndef LZ_RADIX_SORT_HPP
+#    define LZ_RADIX_SORT_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <limits>
+#    include <numeric>
+#    include <vector>
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <thread>
+#    endif // LZ_HAS_EXECUTION
+
+namespace lz {
+namespace internal {
+// Maps a key to an unsigned integer with the same ordering, so that it can be sorted byte by byte. Keys that cannot be mapped
+// (i.e. long double or non arithmetic types) are sorted using comparisons instead
+template<class Key, class = void>
+struct RadixTraits : std::false_type {};
+
+template<class Key>
+struct RadixTraits<Key, EnableIf<std::is_integral<Key>::value && !std::is_same<Key, bool>::value>> : std::true_type {
+    using Unsigned = typename std::make_unsigned<Key>::type;
+
+    static Unsigned toUnsigned(const Key key) noexcept {
+        if LZ_CONSTEXPR_IF (std::is_signed<Key>::value) {
+            // Flipping the sign bit maps the signed range onto the unsigned range, in order
+            constexpr auto signBit = static_cast<Unsigned>(Unsigned{ 1 } << (std::numeric_limits<Unsigned>::digits - 1));
+            return static_cast<Unsigned>(static_cast<Unsigned>(key) ^ signBit);
+        }
+        else {
+            return static_cast<Unsigned>(key);
+        }
+    }
+};
+
+template<class Key>
+struct RadixTraits<Key, EnableIf<std::is_floating_point<Key>::value && std::numeric_limits<Key>::is_iec559 &&
+                                 (sizeof(Key) == sizeof(std::uint32_t) || sizeof(Key) == sizeof(std::uint64_t))>>
+    : std::true_type {
+    using Unsigned = Conditional<sizeof(Key) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+    static Unsigned toUnsigned(const Key key) noexcept {
+        constexpr auto signBit = static_cast<Unsigned>(Unsigned{ 1 } << (std::numeric_limits<Unsigned>::digits - 1));
+        Unsigned bits{};
+        std::memcpy(&bits, &key, sizeof(Key));
+        // Negative numbers are stored as sign and magnitude, so all of their bits are inverted to reverse their order
+        return (bits & signBit) != 0 ? static_cast<Unsigned>(~bits) : static_cast<Unsigned>(bits | signBit);
+    }
+};
+
+template<class T>
+struct RadixKeyOf {
+    typename RadixTraits<T>::Unsigned operator()(const T value) const noexcept {
+        return RadixTraits<T>::toUnsigned(value);
+    }
+};
+
+struct PairFirst {
+    template<class Pair>
+    const typename Pair::first_type& operator()(const Pair& pair) const noexcept {
+        return pair.first;
+    }
+};
+
+template<class GetKey>
+struct CompareKeys {
+    GetKey getKey;
+
+    template<class T>
+    bool operator()(const T& a, const T& b) const {
+        return getKey(a) < getKey(b);
+    }
+};
+
+// Runs the partitions of the radix sort, and the comparison sorts of keys that cannot be radix sorted, on the calling thread
+struct SequentialRunner {
+    std::size_t partitions(std::size_t) const noexcept {
+        return 1;
+    }
+
+    template<class Function>
+    void forEach(std::size_t, Function function) const {
+        function(std::size_t{ 0 });
+    }
+
+    template<class Iterator, class Compare>
+    void sort(Iterator begin, Iterator end, Compare compare) const {
+        std::sort(begin, end, compare);
+    }
+
+    template<class Iterator, class Compare>
+    void stableSort(Iterator begin, Iterator end, Compare compare) const {
+        std::stable_sort(begin, end, compare);
+    }
+};
+
+#    ifdef LZ_HAS_EXECUTION
+template<class Execution>
+class ParallelRunner {
+    Execution _execution;
+
+public:
+    explicit ParallelRunner(Execution execution) : _execution(execution) {
+    }
+
+    std::size_t partitions(const std::size_t size) const noexcept {
+        return std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), size));
+    }
+
+    template<class Function>
+    void forEach(const std::size_t partitions, Function function) const {
+        std::vector<std::size_t> indices(partitions);
+        std::iota(indices.begin(), indices.end(), std::size_t{ 0 });
+        std::for_each(_execution, indices.begin(), indices.end(), function);
+    }
+
+    template<class Iterator, class Compare>
+    void sort(Iterator begin, Iterator end, Compare compare) const {
+        std::sort(_execution, begin, end, compare);
+    }
+
+    template<class Iterator, class Compare>
+    void stableSort(Iterator begin, Iterator end, Compare compare) const {
+        std::stable_sort(_execution, begin, end, compare);
+    }
+};
+#    endif // LZ_HAS_EXECUTION
+
+// Sequences smaller than this are sorted using comparisons, because the histograms would cost more than the sort itself
+constexpr std::size_t RadixSortThreshold = 256;
+
+// Stable LSD radix sort, one byte per pass. The input is split in partitions that build their histograms and scatter their
+// elements independently, every partition writing to its own range of every bucket. The histograms of a partition change after
+// every scatter, so they are built again every pass. Passes in which every key has the same byte are skipped
+template<class Item, class GetKey, class Runner>
+void radixSort(std::vector<Item>& items, GetKey getKey, const Runner& runner) {
+    using Unsigned = Decay<decltype(getKey(items.front()))>;
+    constexpr std::size_t buckets = 256;
+    constexpr std::size_t passes = sizeof(Unsigned);
+
+    const std::size_t size = items.size();
+    if (size < RadixSortThreshold) {
+        std::stable_sort(items.begin(), items.end(), CompareKeys<GetKey>{ getKey });
+        return;
+    }
+
+    const std::size_t partitions = runner.partitions(size);
+    const auto bound = [size, partitions](const std::size_t partition) {
+        return size / partitions * partition + std::min(partition, size % partitions);
+    };
+    const auto byteOf = [](const Unsigned key, const std::size_t pass) {
+        return static_cast<std::size_t>((key >> (pass * 8)) & 0xFFu);
+    };
+
+    // The amount of keys with a certain byte does not depend on their order, so the passes to skip are found up front
+    std::vector<std::vector<std::size_t>> totals(partitions, std::vector<std::size_t>(passes * buckets));
+    runner.forEach(partitions, [&](const std::size_t partition) {
+        std::vector<std::size_t>& total = totals[partition];
+        for (std::size_t i = bound(partition); i < bound(partition + 1); ++i) {
+            const Unsigned key = getKey(items[i]);
+            for (std::size_t pass = 0; pass < passes; ++pass) {
+                ++total[pass * buckets + byteOf(key, pass)];
+            }
+        }
+    });
+    std::vector<bool> skip(passes);
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        for (std::size_t bucket = 0; bucket < buckets && !skip[pass]; ++bucket) {
+            std::size_t total = 0;
+            for (std::size_t partition = 0; partition < partitions; ++partition) {
+                total += totals[partition][pass * buckets + bucket];
+            }
+            skip[pass] = total == size;
+        }
+    }
+
+    std::vector<Item> buffer(size);
+    std::vector<std::vector<std::size_t>> offsets(partitions, std::vector<std::size_t>(buckets));
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        if (skip[pass]) {
+            continue;
+        }
+
+        runner.forEach(partitions, [&](const std::size_t partition) {
+            std::vector<std::size_t>& histogram = offsets[partition];
+            std::fill(histogram.begin(), histogram.end(), std::size_t{ 0 });
+            for (std::size_t i = bound(partition); i < bound(partition + 1); ++i) {
+                ++histogram[byteOf(getKey(items[i]), pass)];
+            }
+        });
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+            for (std::size_t partition = 0; partition < partitions; ++partition) {
+                const std::size_t count = offsets[partition][bucket];
+                offsets[partition][bucket] = offset;
+                offset += count;
+            }
+        }
+
+        runner.forEach(partitions, [&](const std::size_t partition) {
+            std::vector<std::size_t>& next = offsets[partition];
+            for (std::size_t i = bound(partition); i < bound(partition + 1); ++i) {
+                buffer[next[byteOf(getKey(items[i]), pass)]++] = std::move(items[i]);
+            }
+        });
+        items.swap(buffer);
+    }
+}
+
+template<class Iterator, class Runner>
+void sortInPlace(Iterator begin, Iterator end, const Runner& runner, std::true_type /* radix sortable */) {
+    using T = ValueType<Iterator>;
+    std::vector<T> values(begin, end);
+    radixSort(values, RadixKeyOf<T>(), runner);
+    std::move(values.begin(), values.end(), begin);
+}
+
+template<class Iterator, class Runner>
+void sortInPlace(Iterator begin, Iterator end, const Runner& runner, std::false_type /* radix sortable */) {
+    runner.sort(begin, end, MAKE_BIN_OP(std::less, ValueType<Iterator>){});
+}
+
+template<class Iterator, class Runner>
+void sortInPlace(Iterator begin, Iterator end, const Runner& runner) {
+    static_assert(IsRandomAccess<Iterator>::value, "sortInPlace requires a random access iterator");
+    sortInPlace(std::move(begin), std::move(end), runner, std::integral_constant<bool, RadixTraits<ValueType<Iterator>>::value>());
+}
+
+// Every key is computed once and stored next to the index of its element
+template<class Key, class Iterator, class KeySelector, class Runner>
+std::vector<std::size_t> argsort(Iterator begin, Iterator end, KeySelector keySelector, const Runner& runner, std::true_type) {
+    using Item = std::pair<typename RadixTraits<Key>::Unsigned, std::size_t>;
+    std::vector<Item> items;
+    for (std::size_t index = 0; begin != end; ++begin, ++index) {
+        items.emplace_back(RadixTraits<Key>::toUnsigned(keySelector(*begin)), index);
+    }
+    radixSort(items, PairFirst(), runner);
+
+    std::vector<std::size_t> indices;
+    indices.reserve(items.size());
+    for (const Item& item : items) {
+        indices.push_back(item.second);
+    }
+    return indices;
+}
+
+template<class Key, class Iterator, class KeySelector, class Runner>
+std::vector<std::size_t> argsort(Iterator begin, Iterator end, KeySelector keySelector, const Runner& runner, std::false_type) {
+    using Item = std::pair<Key, std::size_t>;
+    std::vector<Item> items;
+    for (std::size_t index = 0; begin != end; ++begin, ++index) {
+        items.emplace_back(keySelector(*begin), index);
+    }
+    runner.stableSort(items.begin(), items.end(), CompareKeys<PairFirst>{ PairFirst() });
+
+    std::vector<std::size_t> indices;
+    indices.reserve(items.size());
+    for (const Item& item : items) {
+        indices.push_back(item.second);
+    }
+    return indices;
+}
+
+template<class Iterator, class KeySelector, class Runner>
+std::vector<std::size_t> argsort(Iterator begin, Iterator end, KeySelector keySelector, const Runner& runner) {
+    using Key = Decay<FunctionReturnType<KeySelector&, RefType<Iterator>>>;
+    return argsort<Key>(std::move(begin), std::move(end), std::move(keySelector), runner,
+                        std::integral_constant<bool, RadixTraits<Key>::value>());
+}
+
+template<class Iterator, class Runner>
+std::vector<ValueType<Iterator>> sortedVector(Iterator begin, Iterator end, const Runner& runner) {
+    std::vector<ValueType<Iterator>> values(std::move(begin), std::move(end));
+    sortInPlace(values.begin(), values.end(), runner);
+    return values;
+}
+
+template<class Iterator, class KeySelector, class Runner>
+std::vector<ValueType<Iterator>> sortedVector(Iterator begin, Iterator end, KeySelector keySelector, const Runner& runner) {
+    std::vector<ValueType<Iterator>> values(std::move(begin), std::move(end));
+    const std::vector<std::size_t> indices = argsort(values.begin(), values.end(), std::move(keySelector), runner);
+
+    std::vector<ValueType<Iterator>> result;
+    result.reserve(values.size());
+    for (const std::size_t index : indices) {
+        result.push_back(std::move(values[index]));
+    }
+    return result;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_RADIX_SORT_HPP
@@ -32,6 +32,14 @@ public:
         _generator(&generator) {
     }
 
+    // Used by `Random::clone`, so that a copy of a view can draw from another generator
+    RandomIterator(const RandomIterator& other, Generator& generator) :
+        _distribution(other._distribution),
+        _current(other._current),
+        _isWhileTrueLoop(other._isWhileTrueLoop),
+        _generator(&generator) {
+    }
+
     RandomIterator() = default;
 
     LZ_NODISCARD value_type operator*() const {
@@ -0,0 +1,240 @@
+#pragma once
+
+#ifndef LZ_SLIDING_ITERATOR_HPP
+#    define LZ_SLIDING_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <deque>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Running sum of the last `windowSize` elements. Every element is added once and subtracted once. Floating point sums are
+// Kahan compensated, and are recomputed from the window every time the ring buffer wraps around, so that rounding errors of
+// the subtractions cannot accumulate
+template<class T>
+class SlidingSumAggregate {
+public:
+    using value_type = Decay<decltype(std::declval<T>() + std::declval<T>())>;
+
+private:
+    std::vector<T> _ring{};
+    std::size_t _start{};
+    std::size_t _windowSize{};
+    value_type _sum{};
+    value_type _compensation{};
+
+    void add(const value_type value) {
+        if LZ_CONSTEXPR_IF (std::is_floating_point<value_type>::value) {
+            const value_type y = value - _compensation;
+            const value_type t = _sum + y;
+            _compensation = (t - _sum) - y;
+            _sum = t;
+        }
+        else {
+            _sum = static_cast<value_type>(_sum + value);
+        }
+    }
+
+    void recompute() {
+        _sum = value_type{};
+        _compensation = value_type{};
+        for (const T& value : _ring) {
+            add(static_cast<value_type>(value));
+        }
+    }
+
+public:
+    explicit SlidingSumAggregate(const std::size_t windowSize) : _windowSize(windowSize) {
+        LZ_ASSERT(windowSize != 0, "window size must be greater than 0");
+        _ring.reserve(windowSize);
+    }
+
+    SlidingSumAggregate() = default;
+
+    std::size_t windowSize() const noexcept {
+        return _windowSize;
+    }
+
+    bool full() const noexcept {
+        return _ring.size() == _windowSize;
+    }
+
+    void push(T value) {
+        if (!full()) {
+            add(static_cast<value_type>(value));
+            _ring.push_back(std::move(value));
+            return;
+        }
+        const auto incoming = static_cast<value_type>(value);
+        const auto outgoing = static_cast<value_type>(_ring[_start]);
+        _ring[_start] = std::move(value);
+        _start = _start + 1 == _windowSize ? 0 : _start + 1;
+        if (std::is_floating_point<value_type>::value && _start == 0) {
+            recompute();
+        }
+        else {
+            add(incoming);
+            add(static_cast<value_type>(-outgoing));
+        }
+    }
+
+    value_type get() const noexcept {
+        return _sum;
+    }
+};
+
+template<class T>
+class SlidingMeanAggregate {
+    using Sum = SlidingSumAggregate<T>;
+
+public:
+    using value_type = Conditional<std::is_floating_point<typename Sum::value_type>::value, typename Sum::value_type, double>;
+
+private:
+    Sum _sum{};
+
+public:
+    explicit SlidingMeanAggregate(const std::size_t windowSize) : _sum(windowSize) {
+    }
+
+    SlidingMeanAggregate() = default;
+
+    bool full() const noexcept {
+        return _sum.full();
+    }
+
+    void push(T value) {
+        _sum.push(std::move(value));
+    }
+
+    value_type get() const noexcept {
+        return static_cast<value_type>(_sum.get()) / static_cast<value_type>(_sum.windowSize());
+    }
+};
+
+// Monotonic deque: contains the indices and values of the elements that can still become the extreme of a later window, the
+// current extreme at the front. Every element is pushed and popped at most once, which makes this amortized O(1) per element
+template<class T, class Compare, bool Max>
+class SlidingExtremeAggregate {
+public:
+    using value_type = T;
+
+private:
+    std::deque<std::pair<std::size_t, T>> _candidates{};
+    std::size_t _index{};
+    std::size_t _windowSize{};
+    mutable FunctionContainer<Compare> _compare{};
+
+    bool precedes(const T& a, const T& b) const {
+        return Max ? _compare(b, a) : _compare(a, b);
+    }
+
+public:
+    SlidingExtremeAggregate(const std::size_t windowSize, Compare compare) :
+        _windowSize(windowSize),
+        _compare(std::move(compare)) {
+        LZ_ASSERT(windowSize != 0, "window size must be greater than 0");
+    }
+
+    SlidingExtremeAggregate() = default;
+
+    bool full() const noexcept {
+        return _index >= _windowSize;
+    }
+
+    void push(T value) {
+        while (!_candidates.empty() && !precedes(_candidates.back().second, value)) {
+            _candidates.pop_back();
+        }
+        _candidates.emplace_back(_index, std::move(value));
+        ++_index;
+        if (_candidates.front().first + _windowSize < _index) {
+            _candidates.pop_front();
+        }
+    }
+
+    const T& get() const noexcept {
+        return _candidates.front().second;
+    }
+};
+
+// Feeds the elements of the underlying sequence to the aggregate one at a time, every element is dereferenced only once. Copies
+// share the aggregate until one of them is incremented, so copying an iterator is O(1) instead of O(windowSize)
+template<class Iterator, class Aggregate>
+class SlidingIterator {
+public:
+    using iterator_category = typename std::common_type<IterCat<Iterator>, std::forward_iterator_tag>::type;
+    using value_type = Decay<typename Aggregate::value_type>;
+    using reference = value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = DiffType<Iterator>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    std::shared_ptr<Aggregate> _aggregate{};
+    bool _exhausted{ true };
+
+public:
+    SlidingIterator(Iterator iterator, Iterator end, Aggregate aggregate, const bool isEnd) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _exhausted(isEnd) {
+        if (_exhausted) {
+            return;
+        }
+        _aggregate = std::make_shared<Aggregate>(std::move(aggregate));
+        for (; !_aggregate->full() && _iterator != _end; ++_iterator) {
+            _aggregate->push(*_iterator);
+        }
+        _exhausted = !_aggregate->full();
+    }
+
+    SlidingIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _aggregate->get();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    SlidingIterator& operator++() {
+        if (_iterator == _end) {
+            _exhausted = true;
+            return *this;
+        }
+        if (_aggregate.use_count() != 1) {
+            _aggregate = std::make_shared<Aggregate>(*_aggregate);
+        }
+        _aggregate->push(*_iterator);
+        ++_iterator;
+        return *this;
+    }
+
+    SlidingIterator operator++(int) {
+        SlidingIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SlidingIterator& lhs, const SlidingIterator& rhs) {
+        if (lhs._exhausted || rhs._exhausted) {
+            return lhs._exhausted != rhs._exhausted;
+        }
+        return lhs._iterator != rhs._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator==(const SlidingIterator& lhs, const SlidingIterator& rhs) {
+        return !(lhs != rhs); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SLIDING_ITERATOR_HPP
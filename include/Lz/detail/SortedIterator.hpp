@@ -0,0 +1,142 @@
+#pragma once
+
+#ifndef LZ_SORTED_ITERATOR_HPP
+#    define LZ_SORTED_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <functional>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Incremental quicksort (Paredes & Navarro). The elements are copied once, after which only the part that is needed to produce
+// the next element is partitioned. `_bounds` contains the (exclusive) ends of the partitions that are not sorted yet; every
+// element of a partition is smaller than every element of the partitions below it on the stack
+template<class T, class Compare>
+class IncrementalSort {
+    // Partitions smaller than this are sorted at once
+    static constexpr std::size_t SortThreshold = 16;
+
+    std::vector<T> _values{};
+    std::vector<std::size_t> _bounds{};
+    std::size_t _sortedEnd{};
+    FunctionContainer<Compare> _compare;
+
+    using DiffType = typename std::vector<T>::difference_type;
+
+    typename std::vector<T>::iterator at(const std::size_t index) {
+        return _values.begin() + static_cast<DiffType>(index);
+    }
+
+    void partitionNext() {
+        const std::size_t end = _bounds.back();
+        if (end - _sortedEnd <= SortThreshold) {
+            std::sort(at(_sortedEnd), at(end), std::ref(_compare));
+            _sortedEnd = end;
+            _bounds.pop_back();
+            return;
+        }
+
+        // Median of three, which also moves the pivot to the middle
+        const auto first = at(_sortedEnd);
+        const auto middle = at(_sortedEnd + (end - _sortedEnd) / 2);
+        const auto last = at(end - 1);
+        if (_compare(*middle, *first)) {
+            std::iter_swap(middle, first);
+        }
+        if (_compare(*last, *middle)) {
+            std::iter_swap(last, middle);
+            if (_compare(*middle, *first)) {
+                std::iter_swap(middle, first);
+            }
+        }
+        const T pivot = *middle;
+
+        const auto split = std::partition(first, at(end), [this, &pivot](const T& value) { return _compare(value, pivot); });
+        const auto splitIndex = static_cast<std::size_t>(split - _values.begin());
+        if (splitIndex == _sortedEnd) {
+            // No element is smaller than the pivot, so all elements that are equal to the pivot are the smallest elements
+            const auto equalEnd = std::partition(first, at(end), [this, &pivot](const T& value) { return !_compare(pivot, value); });
+            _sortedEnd = static_cast<std::size_t>(equalEnd - _values.begin());
+            if (_sortedEnd == end) {
+                _bounds.pop_back();
+            }
+        }
+        else {
+            _bounds.push_back(splitIndex);
+        }
+    }
+
+public:
+    template<class Iterator>
+    IncrementalSort(Iterator begin, Iterator end, Compare compare) : _values(begin, end), _compare(std::move(compare)) {
+        _bounds.push_back(_values.size());
+    }
+
+    std::size_t size() const noexcept {
+        return _values.size();
+    }
+
+    // Makes sure the element at `index`, and all elements before it, are at their sorted position
+    const T& get(const std::size_t index) {
+        while (_sortedEnd <= index) {
+            partitionNext();
+        }
+        return _values[index];
+    }
+};
+
+template<class T, class Compare>
+class SortedIterator {
+    std::shared_ptr<IncrementalSort<T, Compare>> _sort{};
+    std::size_t _index{};
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+
+    SortedIterator(std::shared_ptr<IncrementalSort<T, Compare>> sort, const std::size_t index) :
+        _sort(std::move(sort)),
+        _index(index) {
+    }
+
+    SortedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _sort->get(_index);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    SortedIterator& operator++() {
+        ++_index;
+        return *this;
+    }
+
+    SortedIterator operator++(int) {
+        SortedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SortedIterator& a, const SortedIterator& b) noexcept {
+        return a._index != b._index;
+    }
+
+    LZ_NODISCARD friend bool operator==(const SortedIterator& a, const SortedIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SORTED_ITERATOR_HPP
@@ -0,0 +1,120 @@
+#pragma once
+
+#ifndef LZ_SPLIT_HPP
+#    define LZ_SPLIT_HPP
+
+#    include "BasicIteratorView.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <thread>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// A view can be split into parts that are processed independently if the position of any of its elements can be computed in
+// O(1), without evaluating the elements before it. This holds for all random access iterators, which includes those of Range,
+// Map, Zip, Enumerate, TakeEvery, Chunks, CartesianProduct and Concatenate, as long as the iterators they wrap are random
+// access too. Specialize this for other iterators that can be split
+template<class Iterator>
+struct IsSplittable : IsRandomAccess<Iterator> {};
+
+template<class Iterator, class Function>
+class MapIterator;
+
+template<class... Iterators>
+class ZipIterator;
+
+template<class Iterator, class Arithmetic>
+class EnumerateIterator;
+
+template<class Iterator>
+class CacheIterator;
+
+template<class Iterator>
+class CacheLastIterator;
+
+template<class Arithmetic, class Distribution, class Generator>
+class RandomIterator;
+
+template<class Engine>
+class ThreadLocalEngine;
+
+// Zip iterators are never more than forward iterators, because they cannot be decremented if the sequences have different
+// lengths. They can be advanced and subtracted in O(1) if their iterators can, so they can be split nonetheless, as can the
+// iterators that wrap them
+template<class... Iterators>
+struct AllSplittable : std::true_type {};
+
+template<class Iterator, class... Iterators>
+struct AllSplittable<Iterator, Iterators...>
+    : std::integral_constant<bool, IsSplittable<Iterator>::value && AllSplittable<Iterators...>::value> {};
+
+template<class... Iterators>
+struct IsSplittable<ZipIterator<Iterators...>> : AllSplittable<Iterators...> {};
+
+template<class Iterator, class Function>
+struct IsSplittable<MapIterator<Iterator, Function>> : IsSplittable<Iterator> {};
+
+template<class Iterator, class Arithmetic>
+struct IsSplittable<EnumerateIterator<Iterator, Arithmetic>> : IsSplittable<Iterator> {};
+
+// The copies of cache iterators share their storage, which is written to when an element is dereferenced, so the parts of a
+// cached view cannot be evaluated from different threads
+template<class Iterator>
+struct IsSplittable<CacheIterator<Iterator>> : std::false_type {};
+
+template<class Iterator>
+struct IsSplittable<CacheLastIterator<Iterator>> : std::false_type {};
+
+// The iterators of a random view share its generator, which can only be used from several threads at once if it is local to
+// every thread
+template<class Arithmetic, class Distribution, class Generator>
+struct IsSplittable<RandomIterator<Arithmetic, Distribution, Generator>> : std::false_type {};
+
+template<class Arithmetic, class Distribution, class Engine>
+struct IsSplittable<RandomIterator<Arithmetic, Distribution, ThreadLocalEngine<Engine>>> : std::true_type {};
+
+// Returns the size of a view if it can be computed without evaluating the view, which holds for splittable views, and 0 otherwise
+template<class Iterator>
+std::size_t knownSize(const Iterator& begin, const Iterator& end, std::true_type /* splittable */) {
+    return static_cast<std::size_t>(end - begin);
+}
+
+template<class Iterator>
+std::size_t knownSize(const Iterator&, const Iterator&, std::false_type /* splittable */) {
+    return 0;
+}
+
+template<class Iterator>
+std::size_t knownSize(const Iterator& begin, const Iterator& end) {
+    return knownSize(begin, end, IsSplittable<Iterator>());
+}
+
+inline std::size_t defaultParts() noexcept {
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+// Splits [begin, end) into at most `parts` views of (almost) equal size. The first views are one element larger if the size is
+// not divisible by the amount of parts. An empty sequence results in one empty view
+template<class Iterator>
+std::vector<BasicIteratorView<Iterator>> splitRange(const Iterator& begin, const Iterator& end, std::size_t parts) {
+    static_assert(IsSplittable<Iterator>::value, "The iterator must be splittable (i.e. random access) to be split");
+    const auto size = static_cast<std::size_t>(end - begin);
+    parts = std::max<std::size_t>(1, std::min(parts, size));
+
+    std::vector<BasicIteratorView<Iterator>> views;
+    views.reserve(parts);
+    Iterator first = begin;
+    for (std::size_t part = 0; part < parts; ++part) {
+        const std::size_t partSize = size / parts + (part < size % parts ? 1 : 0);
+        Iterator last = first + static_cast<DiffType<Iterator>>(partSize);
+        views.emplace_back(first, last);
+        first = std::move(last);
+    }
+    return views;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SPLIT_HPP
@@ -12,6 +12,8 @@ namespace internal {
 template<class SubString, class String, class StringType>
 class SplitIterator {
     std::size_t _currentPos{}, _lastPos{};
+    // Only read from, so views over the same string can be iterated over from different threads at once, as long as the string
+    // is not modified
     const String* _string{ nullptr };
     StringType _delimiter{};
 
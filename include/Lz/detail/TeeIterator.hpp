@@ -0,0 +1,160 @@
+#pragma once
+
+#ifndef LZ_TEE_ITERATOR_HPP
+#    define LZ_TEE_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <deque>
+#    include <limits>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The source is iterated over once. Every element is buffered until all consumers have passed it, so the buffer only contains
+// the elements between the slowest and the fastest consumer
+template<class Iterator>
+class TeeState {
+public:
+    using value_type = ValueType<Iterator>;
+
+private:
+    static constexpr std::size_t Released = (std::numeric_limits<std::size_t>::max)();
+
+    Iterator _iterator;
+    Iterator _end;
+    std::deque<value_type> _buffer{};
+    // The position of the first buffered element in the sequence
+    std::size_t _first{ 0 };
+    std::vector<std::size_t> _positions;
+
+    void dropPassed() {
+        const std::size_t slowest = *std::min_element(_positions.begin(), _positions.end());
+        while (_first < slowest && !_buffer.empty()) {
+            _buffer.pop_front();
+            ++_first;
+        }
+    }
+
+public:
+    TeeState(Iterator begin, Iterator end, const std::size_t consumers) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _positions(consumers, 0) {
+    }
+
+    // Returns false if the consumer has reached the end
+    bool fetch(const std::size_t consumer) {
+        const std::size_t position = _positions[consumer];
+        while (position - _first >= _buffer.size()) {
+            if (_iterator == _end) {
+                return false;
+            }
+            _buffer.push_back(*_iterator);
+            ++_iterator;
+        }
+        return true;
+    }
+
+    // References to buffered elements stay valid when other elements are buffered or dropped
+    const value_type& current(const std::size_t consumer) {
+        fetch(consumer);
+        return _buffer[_positions[consumer] - _first];
+    }
+
+    void next(const std::size_t consumer) {
+        fetch(consumer);
+        if (_positions[consumer]++ == _first) {
+            dropPassed();
+        }
+    }
+
+    // Called if the consumer is destroyed, so that the other consumers no longer have to wait for it
+    void release(const std::size_t consumer) {
+        _positions[consumer] = Released;
+        dropPassed();
+    }
+};
+
+template<class Iterator>
+class TeeConsumer {
+    std::shared_ptr<TeeState<Iterator>> _state;
+    std::size_t _index;
+
+public:
+    TeeConsumer(std::shared_ptr<TeeState<Iterator>> state, const std::size_t index) : _state(std::move(state)), _index(index) {
+    }
+
+    TeeConsumer(const TeeConsumer&) = delete;
+    TeeConsumer& operator=(const TeeConsumer&) = delete;
+
+    ~TeeConsumer() {
+        _state->release(_index);
+    }
+
+    bool fetch() const {
+        return _state->fetch(_index);
+    }
+
+    const ValueType<Iterator>& current() const {
+        return _state->current(_index);
+    }
+
+    void next() const {
+        _state->next(_index);
+    }
+};
+
+template<class Iterator>
+class TeeIterator {
+    std::shared_ptr<TeeConsumer<Iterator>> _consumer{};
+
+    bool isEnd() const {
+        return !_consumer || !_consumer->fetch();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ValueType<Iterator>;
+    using difference_type = std::ptrdiff_t;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+    explicit TeeIterator(std::shared_ptr<TeeConsumer<Iterator>> consumer) : _consumer(std::move(consumer)) {
+    }
+
+    TeeIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _consumer->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    TeeIterator& operator++() {
+        _consumer->next();
+        return *this;
+    }
+
+    PostIncrementProxy<value_type> operator++(int) {
+        PostIncrementProxy<value_type> tmp(**this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const TeeIterator& a, const TeeIterator& b) {
+        return a.isEnd() != b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator==(const TeeIterator& a, const TeeIterator& b) {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_TEE_ITERATOR_HPP
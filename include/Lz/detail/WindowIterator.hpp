@@ -0,0 +1,120 @@
+#pragma once
+
+#ifndef LZ_WINDOW_ITERATOR_HPP
+#    define LZ_WINDOW_ITERATOR_HPP
+
+#    include "BasicIteratorView.hpp"
+#    include "RotateIterator.hpp"
+
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// A window over a ring buffer, starting at its oldest element. It shares the ring buffer, which is therefore not overwritten as
+// long as the window exists
+template<class T>
+class RingView final : public BasicIteratorView<RotateIterator<typename std::vector<T>::const_iterator>> {
+    using Ring = std::vector<T>;
+    using Base = BasicIteratorView<RotateIterator<typename Ring::const_iterator>>;
+
+    std::shared_ptr<const Ring> _ring{};
+
+    static Base makeBase(const Ring& ring, const std::size_t start) {
+        const auto first = ring.begin() + static_cast<typename Ring::difference_type>(start);
+        using It = RotateIterator<typename Ring::const_iterator>;
+        return { It(first, ring.begin(), ring.end(), false), It(first, ring.begin(), ring.end(), true) };
+    }
+
+public:
+    RingView(std::shared_ptr<const Ring> ring, const std::size_t start) : Base(makeBase(*ring, start)), _ring(std::move(ring)) {
+    }
+
+    RingView() = default;
+};
+
+// Keeps the last `windowSize` elements in a ring buffer. Every step reads exactly one element from the underlying sequence and
+// overwrites the oldest element, so every element is dereferenced only once, which also makes this usable with input iterators.
+// The ring buffer is shared by the copies of the iterator and by the windows, and is copied only if it is incremented while it
+// is shared, so that a window stays valid after the iterator is incremented or destroyed
+template<class Iterator>
+class WindowIterator {
+    using Ring = std::vector<ValueType<Iterator>>;
+
+public:
+    using iterator_category = typename std::common_type<IterCat<Iterator>, std::forward_iterator_tag>::type;
+    using value_type = RingView<ValueType<Iterator>>;
+    using reference = value_type;
+    using pointer = FakePointerProxy<value_type>;
+    using difference_type = DiffType<Iterator>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    std::shared_ptr<Ring> _ring{};
+    // Index of the oldest element in `_ring`
+    std::size_t _start{};
+    bool _exhausted{ true };
+
+public:
+    WindowIterator(Iterator iterator, Iterator end, const std::size_t windowSize, const bool isEnd) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _exhausted(isEnd) {
+        LZ_ASSERT(windowSize != 0, "window size must be greater than 0");
+        if (_exhausted) {
+            return;
+        }
+        _ring = std::make_shared<Ring>();
+        _ring->reserve(windowSize);
+        for (; _ring->size() != windowSize && _iterator != _end; ++_iterator) {
+            _ring->push_back(*_iterator);
+        }
+        _exhausted = _ring->size() != windowSize;
+    }
+
+    WindowIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return { _ring, _start };
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    WindowIterator& operator++() {
+        if (_iterator == _end) {
+            _exhausted = true;
+            return *this;
+        }
+        if (_ring.use_count() != 1) {
+            _ring = std::make_shared<Ring>(*_ring);
+        }
+        (*_ring)[_start] = *_iterator;
+        ++_iterator;
+        _start = _start + 1 == _ring->size() ? 0 : _start + 1;
+        return *this;
+    }
+
+    WindowIterator operator++(int) {
+        WindowIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const WindowIterator& lhs, const WindowIterator& rhs) {
+        if (lhs._exhausted || rhs._exhausted) {
+            return lhs._exhausted != rhs._exhausted;
+        }
+        return lhs._iterator != rhs._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator==(const WindowIterator& lhs, const WindowIterator& rhs) {
+        return !(lhs != rhs); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_WINDOW_ITERATOR_HPP
@@ -6,20 +6,38 @@ module;
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <charconv>
+#include <cerrno>
 #include <cmath>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#endif
 #include <execution>
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <random>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -31,15 +49,21 @@ export module lz;
 #define LZ_MODULE_EXPORT_SCOPE_END }
 
 export {
+#include "Lz/AsyncBuffer.hpp"
 #include "Lz/CString.hpp"
+#include "Lz/Cache.hpp"
 #include "Lz/CartesianProduct.hpp"
 #include "Lz/ChunkIf.hpp"
 #include "Lz/Chunks.hpp"
 #include "Lz/Concatenate.hpp"
+#include "Lz/Coroutine.hpp"
 #include "Lz/Enumerate.hpp"
 #include "Lz/Except.hpp"
 #include "Lz/Exclude.hpp"
+#include "Lz/Expression.hpp"
+#include "Lz/ExternalSort.hpp"
 #include "Lz/Filter.hpp"
+#include "Lz/FilterBatch.hpp"
 #include "Lz/Flatten.hpp"
 #include "Lz/FunctionTools.hpp"
 #include "Lz/Generate.hpp"
@@ -49,14 +73,26 @@ export {
 #include "Lz/Loop.hpp"
 #include "Lz/Lz.hpp"
 #include "Lz/Map.hpp"
+#include "Lz/MapBatch.hpp"
+#include "Lz/MergeSorted.hpp"
+#include "Lz/Parallel.hpp"
+#include "Lz/ParallelMap.hpp"
+#include "Lz/Quantiles.hpp"
 #include "Lz/Random.hpp"
 #include "Lz/Range.hpp"
 #include "Lz/Repeat.hpp"
 #include "Lz/Rotate.hpp"
+#include "Lz/Sliding.hpp"
+#include "Lz/Sorted.hpp"
+#include "Lz/Stats.hpp"
 #include "Lz/StringSplitter.hpp"
 #include "Lz/Take.hpp"
 #include "Lz/TakeEvery.hpp"
+#include "Lz/Tee.hpp"
+#include "Lz/ThreadPool.hpp"
+#include "Lz/TopK.hpp"
 #include "Lz/Unique.hpp"
+#include "Lz/Window.hpp"
 #include "Lz/Zip.hpp"
 #include "Lz/ZipLongest.hpp"
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "Lz/AsyncBuffer.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("AsyncBuffer basic functionality", "[AsyncBuffer][Basic functionality]") {
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+
+    SECTION("Should keep the order") {
+        CHECK(lz::asyncBuffer(v, 7).toVector() == v);
+        CHECK(lz::asyncBuffer(v, 1).toVector() == v);
+    }
+
+    SECTION("Should evaluate the source on another thread") {
+        const std::thread::id consumer = std::this_thread::get_id();
+        std::atomic<int> onConsumer(0);
+        std::function<int(int)> record = [consumer, &onConsumer](const int i) {
+            if (std::this_thread::get_id() == consumer) {
+                ++onConsumer;
+            }
+            return i;
+        };
+        CHECK(lz::asyncBuffer(lz::map(v, std::move(record)), 16).toVector() == v);
+        CHECK(onConsumer == 0);
+    }
+
+    SECTION("Should buffer input sequences") {
+        std::istringstream stream("1 2 3 4 5");
+        auto buffered = lz::asyncBufferRange(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 2);
+        CHECK(buffered.toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+    }
+
+    SECTION("Should rethrow exceptions after the elements before them") {
+        std::function<int(int)> fail = [](const int i) {
+            if (i == 500) {
+                throw std::runtime_error("");
+            }
+            return i;
+        };
+        auto buffered = lz::asyncBuffer(lz::map(v, std::move(fail)), 8);
+        int count = 0;
+        CHECK_THROWS_AS(std::for_each(buffered.begin(), buffered.end(), [&count](int) { ++count; }), std::runtime_error);
+        CHECK(count == 500);
+    }
+
+    SECTION("Should stop the producer if the result is destroyed early") {
+        std::atomic<int> produced(0);
+        std::function<int(int)> count = [&produced](const int i) {
+            ++produced;
+            return i;
+        };
+        {
+            auto buffered = lz::asyncBuffer(lz::map(lz::range(1000000), std::move(count)), 4);
+            auto it = buffered.begin();
+            CHECK(*it == 0);
+            ++it;
+            CHECK(*it == 1);
+        }
+        CHECK(produced <= 7);
+    }
+
+    SECTION("Should be empty for empty sequences") {
+        std::vector<int> empty;
+        auto buffered = lz::asyncBuffer(empty);
+        CHECK(buffered.begin() == buffered.end());
+    }
+}
@@ -0,0 +1,140 @@
+#include "Lz/Cache.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <sstream>
+
+TEST_CASE("Cache basic functionality", "[Cache][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4 };
+    int calls = 0;
+    std::function<int(int)> timesTen = [&calls](const int i) {
+        ++calls;
+        return i * 10;
+    };
+    auto mapped = lz::map(v, std::move(timesTen));
+
+    SECTION("Should evaluate every element once") {
+        auto cached = lz::cache(mapped);
+        CHECK(cached.toVector() == std::vector<int>{ 10, 20, 30, 40 });
+        CHECK(cached.toVector() == std::vector<int>{ 10, 20, 30, 40 });
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should only evaluate what is needed") {
+        auto cached = lz::cache(mapped);
+        auto it = cached.begin();
+        CHECK(*std::next(it) == 20);
+        CHECK(calls == 2);
+    }
+
+    SECTION("Should support random access") {
+        auto cached = lz::cache(mapped);
+        CHECK(cached.end() - cached.begin() == 4);
+        CHECK(cached.begin()[3] == 40);
+        CHECK(*(cached.end() - 1) == 40);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should not evaluate bidirectional sequences up front") {
+        std::list<int> list(v.begin(), v.end());
+        auto cached = lz::cache(lz::map(list, [&calls](const int i) {
+            ++calls;
+            return i;
+        }));
+        CHECK(calls == 0);
+        CHECK(cached.toVector() == v);
+        CHECK(cached.toVector() == v);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should make input iterators multi pass") {
+        std::istringstream stream("1 2 3");
+        auto cached = lz::cacheRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        CHECK(cached.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(cached.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(std::distance(cached.begin(), cached.end()) == 3);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        CHECK(lz::cache(empty).begin() == lz::cache(empty).end());
+    }
+}
+
+TEST_CASE("CacheLast basic functionality", "[CacheLast][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4 };
+    int calls = 0;
+    std::function<int(int)> timesTen = [&calls](const int i) {
+        ++calls;
+        return i * 10;
+    };
+    auto mapped = lz::map(v, std::move(timesTen));
+
+    SECTION("Should evaluate every element once when filtered") {
+        std::function<bool(int)> isLarge = [](const int i) {
+            return i > 20;
+        };
+        auto filtered = lz::filter(lz::cacheLast(mapped), std::move(isLarge));
+        CHECK(filtered.toVector() == std::vector<int>{ 30, 40 });
+        CHECK(calls == 4);
+    }
+
+    SECTION("Should evaluate again after the iterator has moved") {
+        auto cached = lz::cacheLast(mapped);
+        auto it = cached.begin();
+        CHECK(*it == 10);
+        CHECK(*it == 10);
+        ++it;
+        CHECK(*it == 20);
+        --it;
+        CHECK(*it == 10);
+        CHECK(calls == 3);
+        CHECK(it[2] == 30);
+    }
+}
+
+TEST_CASE("Cache binary operations", "[Cache][Binary ops]") {
+    std::list<int> lst = { 1, 2, 3 };
+    auto cached = lz::cache(lst);
+    auto it = cached.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 2);
+    }
+
+    SECTION("Operator--") {
+        std::vector<int> vec(lst.begin(), lst.end());
+        auto end = lz::cache(vec).end();
+        --end;
+        CHECK(*end == 3);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != cached.end());
+        std::advance(it, 3);
+        CHECK(it == cached.end());
+    }
+}
+
+TEST_CASE("Cache to containers", "[Cache][To container]") {
+    std::vector<int> v = { 1, 2, 3 };
+    auto cached = lz::cache(v);
+
+    SECTION("To array") {
+        CHECK(cached.toArray<3>() == std::array<int, 3>{ 1, 2, 3 });
+    }
+
+    SECTION("To vector") {
+        CHECK(cached.toVector() == v);
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(cached.to<std::list<int>>() == std::list<int>{ 1, 2, 3 });
+    }
+}
@@ -63,6 +63,8 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
 
     SECTION("Operator+(int), tests += as well") {
         CHECK(*(begin + static_cast<std::ptrdiff_t>(a.size())) == 'w');
+        CHECK(*(begin + static_cast<std::ptrdiff_t>(a.size() + 2)) == 'r');
+        CHECK(begin + static_cast<std::ptrdiff_t>(a.size() + b.size()) == concat.end());
     }
 
     SECTION("Operator-(int), tests -= as well") {
@@ -0,0 +1,151 @@
+#include "Lz/Coroutine.hpp"
+#include "catch2/catch.hpp"
+
+#ifdef LZ_HAS_COROUTINES
+
+#    include <Lz/Filter.hpp>
+#    include <Lz/Lz.hpp>
+#    include <Lz/Map.hpp>
+#    include <memory_resource>
+#    include <stdexcept>
+#    include <string>
+#    include <vector>
+
+#    if defined(LZ_GCC_VERSION) && LZ_GCC_VERSION < 14
+// See Coroutine.hpp
+#        pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#    endif
+
+namespace {
+struct Node {
+    int value;
+    std::vector<Node> children;
+};
+
+lz::Generator<int> walk(const Node& node) {
+    co_yield node.value;
+    for (const Node& child : node.children) {
+        for (const int value : walk(child)) {
+            co_yield value;
+        }
+    }
+}
+
+lz::Generator<int> countTo(std::allocator_arg_t, std::pmr::memory_resource*, const int n) {
+    for (int i = 1; i <= n; ++i) {
+        co_yield i;
+    }
+}
+
+class CountingResource : public std::pmr::memory_resource {
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    int allocations = 0;
+    int deallocations = 0;
+};
+} // namespace
+
+TEST_CASE("Generator basic functionality", "[Coroutine][Basic functionality]") {
+    SECTION("Should yield the values in order") {
+        const Node tree{ 1, { Node{ 2, { Node{ 3, {} } } }, Node{ 4, {} } } };
+        std::vector<int> values;
+        for (const int value : walk(tree)) {
+            values.push_back(value);
+        }
+        CHECK(values == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Should not start before the first element is requested") {
+        bool started = false;
+        auto generator = [](bool& isStarted) -> lz::Generator<int> {
+            isStarted = true;
+            co_yield 1;
+        }(started);
+        auto it = generator.begin();
+        CHECK(!started);
+        CHECK(*it == 1);
+        CHECK(started);
+    }
+
+    SECTION("Should allocate the frame from the given memory resource") {
+        CountingResource resource;
+        {
+            auto generator = countTo(std::allocator_arg, &resource, 3);
+            CHECK(resource.allocations == 1);
+            CHECK(lz::chain(generator).toVector() == std::vector<int>{ 1, 2, 3 });
+        }
+        CHECK(resource.deallocations == 1);
+    }
+}
+
+TEST_CASE("fromCoroutine basic functionality", "[Coroutine][Basic functionality]") {
+    SECTION("Should keep the function alive") {
+        const std::string prefix = "item";
+        auto view = lz::fromCoroutine([prefix](const int n) -> lz::Generator<std::string> {
+            for (int i = 0; i < n; ++i) {
+                co_yield prefix + std::to_string(i);
+            }
+        }, 3);
+        CHECK(view.toVector() == std::vector<std::string>{ "item0", "item1", "item2" });
+    }
+
+    SECTION("Should be chainable") {
+        const Node tree{ 1, { Node{ 2, { Node{ 3, {} } } }, Node{ 4, {} } } };
+        auto evens = lz::chain(lz::fromCoroutine(walk, tree)).filter([](const int i) { return i % 2 == 0; });
+        CHECK(evens.map([](const int i) { return i * 10; }).toVector() == std::vector<int>{ 20, 40 });
+    }
+
+    SECTION("Should pass the memory resource to the coroutine") {
+        CountingResource resource;
+        CHECK(lz::fromCoroutine(countTo, std::allocator_arg, &resource, 4).toVector() == std::vector<int>{ 1, 2, 3, 4 });
+        CHECK(resource.allocations == 1);
+        CHECK(resource.deallocations == 1);
+    }
+
+    SECTION("Should rethrow exceptions") {
+        auto view = lz::fromCoroutine([]() -> lz::Generator<int> {
+            co_yield 1;
+            throw std::runtime_error("");
+        });
+        auto it = view.begin();
+        CHECK(*it == 1);
+        CHECK_THROWS_AS(++it, std::runtime_error);
+    }
+}
+
+TEST_CASE("toGenerator basic functionality", "[Coroutine][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4 };
+
+    SECTION("Should yield the elements of a view") {
+        std::vector<int> values;
+        for (const int value : lz::chain(v).map([](const int i) { return i * i; }).toGenerator()) {
+            values.push_back(value);
+        }
+        CHECK(values == std::vector<int>{ 1, 4, 9, 16 });
+    }
+
+    SECTION("Should allocate the frame from the given memory resource") {
+        CountingResource resource;
+        {
+            auto generator = lz::toGenerator(std::allocator_arg, &resource, v);
+            CHECK(lz::chain(generator).toVector() == v);
+        }
+        CHECK(resource.allocations == 1);
+        CHECK(resource.deallocations == 1);
+    }
+}
+
+#endif // LZ_HAS_COROUTINES
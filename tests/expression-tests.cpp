@@ -0,0 +1,129 @@
+#include <Lz/Expression.hpp>
+#include <Lz/Map.hpp>
+#include <catch2/catch.hpp>
+#include <functional>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+TEST_CASE("Expression basic functionality", "[Expression][Basic functionality]") {
+    std::vector<int> x = { 1, 2, 3, 4 };
+    std::vector<int> y = { 10, 20, 30, 40 };
+
+    SECTION("Arithmetic between views") {
+        CHECK((lz::view(x) + lz::view(y)).toVector() == std::vector<int>{ 11, 22, 33, 44 });
+        CHECK((lz::view(y) - lz::view(x)).toVector() == std::vector<int>{ 9, 18, 27, 36 });
+        CHECK((lz::view(x) * lz::view(y)).toVector() == std::vector<int>{ 10, 40, 90, 160 });
+        CHECK((lz::view(y) / lz::view(x)).toVector() == std::vector<int>{ 10, 10, 10, 10 });
+        CHECK((lz::view(y) % lz::view(x)).toVector() == std::vector<int>{ 0, 0, 0, 0 });
+    }
+
+    SECTION("Arithmetic with scalars") {
+        CHECK((lz::view(x) * 3).toVector() == std::vector<int>{ 3, 6, 9, 12 });
+        CHECK((10 - lz::view(x)).toVector() == std::vector<int>{ 9, 8, 7, 6 });
+        CHECK((-lz::view(x)).toVector() == std::vector<int>{ -1, -2, -3, -4 });
+        CHECK((lz::view(x) / 2.).toVector() == std::vector<double>{ .5, 1., 1.5, 2. });
+    }
+
+    SECTION("Nested expressions") {
+        auto expr = lz::view(x) + lz::view(y) * 3;
+        CHECK(expr.toVector() == std::vector<int>{ 31, 62, 93, 124 });
+        CHECK(((lz::view(x) + 1) * (lz::view(x) - 1)).toVector() == std::vector<int>{ 0, 3, 8, 15 });
+    }
+
+    SECTION("Comparisons") {
+        CHECK((lz::view(x) > 2).toVector() == std::vector<bool>{ false, false, true, true });
+        CHECK((lz::view(x) >= 2).toVector() == std::vector<bool>{ false, true, true, true });
+        CHECK((lz::view(x) < 2).toVector() == std::vector<bool>{ true, false, false, false });
+        CHECK((lz::view(x) * 10 <= lz::view(y)).toVector() == std::vector<bool>{ true, true, true, true });
+    }
+
+    SECTION("Is lazy") {
+        auto expr = lz::view(x) * 2;
+        x[0] = 100;
+        CHECK(*expr.begin() == 200);
+    }
+
+    SECTION("Stops at shortest view") {
+        std::vector<int> shorter = { 1, 2 };
+        auto expr = lz::view(x) + lz::view(shorter);
+        CHECK(expr.toVector() == std::vector<int>{ 2, 4 });
+        CHECK(expr.distance() == 2);
+    }
+
+    SECTION("Works with other views and non random access sequences") {
+        std::list<int> list = { 1, 2, 3, 4 };
+        std::function<int(int)> timesTwo = [](int i) {
+            return i * 2;
+        };
+        auto expr = lz::view(list) + lz::map(x, timesTwo);
+        CHECK(expr.toVector() == std::vector<int>{ 3, 6, 9, 12 });
+    }
+}
+
+TEST_CASE("Expression binary operations", "[Expression][Binary ops]") {
+    std::vector<int> x = { 1, 2, 3, 4 };
+    auto expr = lz::view(x) * 2;
+    auto it = expr.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(*it == 4);
+    }
+
+    SECTION("Operator--") {
+        auto end = expr.end();
+        --end;
+        CHECK(*end == 8);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != expr.end());
+        it = expr.end();
+        CHECK(it == expr.end());
+    }
+
+    SECTION("Operator+(int) offset, tests += as well") {
+        CHECK(*(it + 2) == 6);
+        CHECK(it[3] == 8);
+    }
+
+    SECTION("Operator-(Iterator)") {
+        CHECK(expr.end() - expr.begin() == 4);
+        CHECK(std::distance(expr.begin(), expr.end()) == 4);
+    }
+}
+
+TEST_CASE("Expression to containers", "[Expression][To container]") {
+    std::vector<int> x = { 1, 2, 3 };
+    auto expr = lz::view(x) + 1;
+
+    SECTION("To array") {
+        CHECK(expr.toArray<3>() == std::array<int, 3>{ 2, 3, 4 });
+    }
+
+    SECTION("To vector") {
+        CHECK(expr.toVector() == std::vector<int>{ 2, 3, 4 });
+        CHECK(expr.toVector(std::allocator<int>()) == std::vector<int>{ 2, 3, 4 });
+    }
+
+    SECTION("Copy to") {
+        std::vector<int> out(3);
+        expr.copyTo(out.begin());
+        CHECK(out == std::vector<int>{ 2, 3, 4 });
+    }
+
+    SECTION("To list") {
+        CHECK(expr.to<std::list>() == std::list<int>{ 2, 3, 4 });
+    }
+
+    SECTION("To map") {
+        std::map<int, int> actual = expr.toMap([](const int i) { return i; });
+        CHECK(actual == std::map<int, int>{ { 2, 2 }, { 3, 3 }, { 4, 4 } });
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> actual = expr.toUnorderedMap([](const int i) { return i; });
+        CHECK(actual == std::unordered_map<int, int>{ { 2, 2 }, { 3, 3 }, { 4, 4 } });
+    }
+}
@@ -0,0 +1,159 @@
+#include <Lz/ExternalSort.hpp>
+#include <Lz/Map.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <list>
+#include <map>
+#include <memory>
+#include <system_error>
+#include <unordered_map>
+
+namespace {
+struct Record {
+    int key;
+    int index;
+
+    friend bool operator==(const Record& a, const Record& b) {
+        return a.key == b.key && a.index == b.index;
+    }
+};
+} // namespace
+
+TEST_CASE("External sort with runs on disk", "[ExternalSort][Basic functionality]") {
+    std::vector<int> vec(1000);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % vec.size());
+    }
+
+    SECTION("Should sort using multiple runs") {
+        auto sorted = lz::externalSort(vec, std::less<int>(), 64 * sizeof(int)).toVector();
+        REQUIRE(sorted.size() == vec.size());
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+        CHECK(sorted.front() == 0);
+        CHECK(sorted.back() == 999);
+    }
+
+    SECTION("Should keep the value of a postfix increment") {
+        auto sorted = lz::externalSort(vec, std::less<int>(), 64 * sizeof(int));
+        auto it = sorted.begin();
+        auto previous = it++;
+        CHECK(*previous == 0);
+        CHECK(*it == 1);
+    }
+
+    SECTION("Should sort in memory if the budget allows it") {
+        auto sorted = lz::externalSort(vec).toVector();
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+        CHECK(sorted.size() == vec.size());
+    }
+
+    SECTION("Should use a custom comparer") {
+        auto sorted = lz::externalSort(vec, std::greater<int>(), 100).toVector();
+        CHECK(std::is_sorted(sorted.begin(), sorted.end(), std::greater<int>()));
+    }
+
+    SECTION("Should be stable") {
+        std::vector<Record> records;
+        for (int i = 0; i < 200; ++i) {
+            records.push_back(Record{ i % 3, i });
+        }
+        auto byKey = [](const Record& a, const Record& b) { return a.key < b.key; };
+        auto sorted = lz::externalSort(records, byKey, 16 * sizeof(Record)).toVector();
+        std::stable_sort(records.begin(), records.end(), byKey);
+        CHECK(sorted == records);
+    }
+
+    SECTION("Should sort strings from a lazy sequence") {
+        std::list<int> list = { 3, 10, 1, 22, 7 };
+        auto strings = lz::map(list, [](const int i) { return std::to_string(i); });
+        auto sorted = lz::externalSort(strings, std::less<std::string>(), 1).toVector();
+        CHECK(sorted == std::vector<std::string>{ "1", "10", "22", "3", "7" });
+    }
+
+    SECTION("Should write to a given directory") {
+        auto sorted = lz::externalSort(vec, std::less<int>(), 128, ".").toVector();
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+    }
+
+    SECTION("Should merge at most a fixed amount of runs at once") {
+        using Merge = lz::internal::ExternalMerge<int, std::less<int>>;
+        std::vector<int> many(2000);
+        for (std::size_t i = 0; i < many.size(); ++i) {
+            many[i] = static_cast<int>((i * 7919) % many.size());
+        }
+        Merge merge(many.begin(), many.end(), std::less<int>(), sizeof(int), "");
+        CHECK(merge.runs() <= Merge::MaxFanIn);
+
+        auto sorted = lz::externalSort(many, std::less<int>(), sizeof(int)).toVector();
+        REQUIRE(sorted.size() == many.size());
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+        CHECK(sorted.back() == 1999);
+    }
+
+    SECTION("Should stay stable when runs are merged in passes") {
+        std::vector<Record> records;
+        for (int i = 0; i < 1000; ++i) {
+            records.push_back(Record{ (i * 7) % 5, i });
+        }
+        auto byKey = [](const Record& a, const Record& b) { return a.key < b.key; };
+        auto sorted = lz::externalSort(records, byKey, 3 * sizeof(Record)).toVector();
+        std::stable_sort(records.begin(), records.end(), byKey);
+        CHECK(sorted == records);
+    }
+
+    SECTION("Should throw if a run ends within an element") {
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::tmpfile(), &std::fclose);
+        REQUIRE(file != nullptr);
+        const int value = 7;
+        lz::internal::RunSerializer<int>::write(file.get(), value);
+        REQUIRE(std::fwrite(&value, 1, 2, file.get()) == 2);
+        std::rewind(file.get());
+
+        int read = 0;
+        CHECK(lz::internal::RunSerializer<int>::read(file.get(), read));
+        CHECK(read == 7);
+        CHECK_THROWS_AS(lz::internal::RunSerializer<int>::read(file.get(), read), std::system_error);
+    }
+
+    SECTION("Should end a run at an element boundary") {
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::tmpfile(), &std::fclose);
+        REQUIRE(file != nullptr);
+        lz::internal::RunSerializer<std::string>::write(file.get(), "abc");
+        std::rewind(file.get());
+
+        std::string read;
+        CHECK(lz::internal::RunSerializer<std::string>::read(file.get(), read));
+        CHECK(read == "abc");
+        CHECK_FALSE(lz::internal::RunSerializer<std::string>::read(file.get(), read));
+    }
+
+    SECTION("Should handle empty sequences") {
+        CHECK(lz::externalSort(std::vector<int>()).toVector().empty());
+    }
+}
+
+TEST_CASE("External sort to containers", "[ExternalSort][To container]") {
+    std::vector<int> vec = { 3, 1, 2 };
+
+    SECTION("To array") {
+        CHECK(lz::externalSort(vec, std::less<int>(), 4).toArray<3>() == std::array<int, 3>{ 1, 2, 3 });
+    }
+
+    SECTION("To vector") {
+        CHECK(lz::externalSort(vec, std::less<int>(), 4).toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(lz::externalSort(vec, std::less<int>(), 4).to<std::list<int>>() == std::list<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To map") {
+        std::map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(lz::externalSort(vec, std::less<int>(), 4).toMap([](const int i) { return i; }) == expected);
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(lz::externalSort(vec, std::less<int>(), 4).toUnorderedMap([](const int i) { return i; }) == expected);
+    }
+}
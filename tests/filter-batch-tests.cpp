@@ -0,0 +1,143 @@
+#include <Lz/FilterBatch.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <catch2/catch.hpp>
+#include <functional>
+#include <list>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+struct IsEvenBatch {
+    std::uint64_t operator()(const int* block, const std::size_t count) const {
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            mask |= static_cast<std::uint64_t>(block[i] % 2 == 0) << i;
+        }
+        return mask;
+    }
+};
+} // namespace
+
+TEST_CASE("FilterBatch filters and is by reference", "[FilterBatch][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("Should filter out elements") {
+        auto filter = lz::filterBatch(vec, IsEvenBatch());
+        CHECK(filter.toVector() == std::vector<int>{ 2, 4, 6 });
+    }
+
+    SECTION("Should be by reference") {
+        auto filter = lz::filterBatch(vec, IsEvenBatch());
+        *filter.begin() = 50;
+        CHECK(vec[1] == 50);
+    }
+
+    SECTION("Should ignore bits beyond the block size") {
+        auto filter = lz::filterBatch(vec, [](const int*, std::size_t) { return ~std::uint64_t{ 0 }; });
+        CHECK(filter.toVector() == vec);
+    }
+
+    SECTION("Should work over multiple blocks") {
+        std::vector<int> large = lz::range(1000).toVector();
+        auto filter = lz::filterBatch(large, IsEvenBatch());
+        std::vector<int> expected;
+        for (int i = 0; i < 1000; i += 2) {
+            expected.push_back(i);
+        }
+        CHECK(filter.toVector() == expected);
+    }
+
+    SECTION("Should skip complete blocks") {
+        std::vector<int> large(200, 1);
+        large[150] = 2;
+        auto filter = lz::filterBatch(large, IsEvenBatch());
+        CHECK(filter.toVector() == std::vector<int>{ 2 });
+        CHECK(&*filter.begin() == &large[150]);
+    }
+
+    SECTION("Should work with non contiguous sequences") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto filter = lz::filterBatch(list, IsEvenBatch());
+        CHECK(filter.toVector() == std::vector<int>{ 2, 4, 6 });
+        *filter.begin() = 50;
+        CHECK(list.front() == 1);
+        CHECK(*std::next(list.begin()) == 50);
+    }
+
+    SECTION("Should evaluate elements that are returned by value once") {
+        std::list<int> list(100, 2);
+        int evaluated = 0;
+        std::function<int(int)> count = [&evaluated](const int i) {
+            ++evaluated;
+            return i;
+        };
+        auto filter = lz::filterBatch(lz::map(list, std::move(count)), IsEvenBatch());
+        CHECK(filter.toVector() == std::vector<int>(100, 2));
+        CHECK(evaluated == 100);
+    }
+
+    SECTION("Copies should keep their block when another copy moves on") {
+        std::list<int> list(200);
+        std::iota(list.begin(), list.end(), 0);
+        auto filter = lz::filterBatch(lz::map(list, [](const int i) { return i; }), IsEvenBatch());
+        auto it = filter.begin();
+        auto copy = it;
+        std::advance(copy, 40);
+        CHECK(*copy == 80);
+        CHECK(*it == 0);
+        CHECK(*++it == 2);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto filter = lz::filterBatch(empty, IsEvenBatch());
+        CHECK(filter.begin() == filter.end());
+        auto none = lz::filterBatch(vec, [](const int*, std::size_t) { return std::uint64_t{ 0 }; });
+        CHECK(none.begin() == none.end());
+    }
+}
+
+TEST_CASE("FilterBatch binary operations", "[FilterBatch][Binary ops]") {
+    std::array<int, 5> array = { 1, 2, 3, 4, 6 };
+    auto filter = lz::filterBatch(array, IsEvenBatch());
+    auto it = filter.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 4);
+        ++it;
+        CHECK(*it == 6);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != filter.end());
+        it = filter.end();
+        CHECK(it == filter.end());
+    }
+}
+
+TEST_CASE("FilterBatch to containers", "[FilterBatch][To container]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+    auto filter = lz::filterBatch(vec, IsEvenBatch());
+
+    SECTION("To array") {
+        CHECK(filter.toArray<3>() == std::array<int, 3>{ 2, 4, 6 });
+    }
+
+    SECTION("To list") {
+        CHECK(filter.to<std::list>() == std::list<int>{ 2, 4, 6 });
+    }
+
+    SECTION("To map") {
+        std::map<int, int> map = filter.toMap([](const int i) { return i; });
+        CHECK(map == std::map<int, int>{ { 2, 2 }, { 4, 4 }, { 6, 6 } });
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> map = filter.toUnorderedMap([](const int i) { return i; });
+        CHECK(map == std::unordered_map<int, int>{ { 2, 2 }, { 4, 4 }, { 6, 6 } });
+    }
+}
@@ -3,6 +3,12 @@
 
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <functional>
+#include <list>
+#include <set>
+#ifdef __cpp_lib_optional
+#    include <optional>
+#endif
 
 TEST_CASE("Function tools") {
     std::vector<int> ints = { 1, 2, 3, 4 };
@@ -133,6 +139,28 @@ TEST_CASE("Function tools") {
         CHECK(std::equal(f.begin(), f.end(), expected.begin()));
     }
 
+    SECTION("FilterMapOpt") {
+        std::vector<int> values = { 1, -2, 3, -4 };
+        int calls = 0;
+        auto positives = lz::filterMapOpt(values, [&calls](const int& i) {
+            ++calls;
+            return i > 0 ? &i : nullptr;
+        });
+        CHECK(positives.toVector() == std::vector<int>{ 1, 3 });
+        CHECK(calls == 4);
+
+        std::vector<int> empty;
+        auto none = lz::filterMapOpt(empty, [](const int& i) { return &i; });
+        CHECK(none.begin() == none.end());
+#ifdef __cpp_lib_optional
+        std::string s = "1a2b3";
+        auto digits = lz::filterMapOpt(s, [](const char c) {
+            return std::isdigit(static_cast<unsigned char>(c)) ? std::optional<int>(c - '0') : std::nullopt;
+        });
+        CHECK(digits.toVector() == std::vector<int>{ 1, 2, 3 });
+#endif
+    }
+
     SECTION("To string func") {
         std::vector<int> v = { 1, 2, 3, 4, 5 };
         auto dummy = lz::map(v, [](int i) { return i; });
@@ -179,6 +207,53 @@ TEST_CASE("Function tools") {
         CHECK(lz::containsIf(s, [](char c) { return c == 'h'; }));
     }
 
+    SECTION("Contiguous search fast paths") {
+        std::vector<short> shorts(37, 1);
+        shorts[33] = 7;
+        CHECK(lz::indexOf(shorts, 7) == 33);
+        CHECK(lz::contains(shorts, 7));
+        CHECK(!lz::contains(shorts, 8));
+
+        std::vector<long long> longs(21, 5);
+        longs[20] = (1LL << 40) + 3;
+        CHECK(lz::indexOf(longs, (1LL << 40) + 3) == 20);
+        CHECK(lz::indexOf(longs, 3) == lz::npos);
+
+        std::vector<int> many(100);
+        std::iota(many.begin(), many.end(), 0);
+        CHECK(lz::indexOf(many, 42) == 42);
+        CHECK(lz::indexOf(many, 100) == lz::npos);
+
+        std::vector<unsigned char> bytes = { 0, 255, 3 };
+        CHECK(!lz::contains(bytes, -1));
+        CHECK(lz::indexOf(bytes, 255) == 1);
+    }
+
+    SECTION("Starts with and ends with") {
+        std::string s = "hello world";
+        CHECK(lz::startsWith(s, std::string("hello")));
+        CHECK(!lz::startsWith(s, std::string("world")));
+        CHECK(!lz::startsWith(std::string("he"), std::string("hello")));
+        CHECK(lz::endsWith(s, std::string("world")));
+        CHECK(!lz::endsWith(s, std::string("hello")));
+        CHECK(!lz::endsWith(std::string("ld"), std::string("world")));
+
+        std::list<int> list = { 1, 2, 3, 4 };
+        CHECK(lz::startsWith(list, std::vector<int>{ 1, 2 }));
+        CHECK(!lz::startsWith(list, std::vector<int>{ 2, 3 }));
+        CHECK(lz::endsWith(list, std::vector<int>{ 3, 4 }));
+        CHECK(!lz::endsWith(list, std::vector<int>{ 2, 3 }));
+    }
+
+    SECTION("Equal") {
+        std::vector<int> a = { 1, 2, 3 };
+        CHECK(lz::equal(a, std::vector<int>{ 1, 2, 3 }));
+        CHECK(!lz::equal(a, std::vector<int>{ 1, 2 }));
+        CHECK(!lz::equal(a, std::vector<int>{ 1, 2, 3, 4 }));
+        CHECK(!lz::equal(a, std::vector<int>{ 1, 2, 4 }));
+        CHECK(lz::equal(a, std::list<int>{ 1, 2, 3 }));
+    }
+
     SECTION("select") {
         std::array<int, 10> range = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
         std::function<bool(int)> even = [](int i) {
@@ -225,3 +300,157 @@ TEST_CASE("Function tools") {
         CHECK(trimming.toString() == "Hello world");
     }
 }
+
+TEST_CASE("Single pass partition and unzip", "[Function tools][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
+    int evaluated = 0;
+    std::function<int(int)> count = [&evaluated](const int i) {
+        ++evaluated;
+        return i;
+    };
+    auto mapped = lz::map(v, std::move(count));
+
+    SECTION("Partition should evaluate every element once") {
+        std::vector<int> evens = { 0 };
+        std::list<int> odds;
+        lz::partitionTo(mapped, evens, odds, [](const int i) { return i % 2 == 0; });
+        CHECK(evens == std::vector<int>{ 0, 2, 4, 6 });
+        CHECK(odds == std::list<int>{ 1, 3, 5, 7 });
+        CHECK(evaluated == 7);
+    }
+
+    SECTION("Unzip should evaluate every element once and reserve exactly") {
+        std::vector<std::string> strings = { "a", "b", "c", "d", "e", "f", "g" };
+        std::vector<int> ints;
+        std::vector<std::string> unzippedStrings;
+        lz::unzipTo(lz::zip(mapped, strings), ints, unzippedStrings);
+        CHECK(ints == v);
+        CHECK(ints.capacity() == 7);
+        CHECK(unzippedStrings == strings);
+        CHECK(unzippedStrings.capacity() == 7);
+        CHECK(evaluated == 7);
+    }
+
+    SECTION("Unzip should accept elements that are temporaries") {
+        std::function<std::pair<std::string, int>(int)> toPair = [](const int i) {
+            return std::make_pair(std::string(32, static_cast<char>('a' + i)), i);
+        };
+        std::set<std::string> keys;
+        std::vector<int> values;
+        lz::unzipTo(lz::map(v, std::move(toPair)), keys, values);
+        CHECK(keys.size() == 7);
+        CHECK(*keys.begin() == std::string(32, 'b'));
+        CHECK(values == v);
+    }
+
+    SECTION("Unzip should allow less outputs than members") {
+        std::vector<std::tuple<int, char, double>> tuples = { std::make_tuple(1, 'a', 1.), std::make_tuple(2, 'b', 2.) };
+        std::vector<int> ints;
+        std::string chars;
+        lz::unzipTo(tuples, ints, chars);
+        CHECK(ints == std::vector<int>{ 1, 2 });
+        CHECK(chars == "ab");
+    }
+}
+
+// Splits the radix sort in several partitions, which are run one after another
+struct FourPartitions : lz::internal::SequentialRunner {
+    std::size_t partitions(std::size_t) const noexcept {
+        return 4;
+    }
+
+    template<class Function>
+    void forEach(const std::size_t partitions, Function function) const {
+        for (std::size_t partition = 0; partition < partitions; ++partition) {
+            function(partition);
+        }
+    }
+};
+
+TEST_CASE("Radix sort", "[Function tools][Radix sort]") {
+    std::vector<long long> big(5000);
+    std::uint64_t state = 42;
+    for (long long& value : big) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        value = static_cast<long long>(state >> 16) - (1LL << 46);
+    }
+    std::vector<long long> expected = big;
+    std::sort(expected.begin(), expected.end());
+
+    SECTION("Sort in place") {
+        lz::sortInPlace(big);
+        CHECK(big == expected);
+
+        std::vector<int> small = { 3, -1, 2, -7, 0 };
+        lz::sortInPlace(small);
+        CHECK(small == std::vector<int>{ -7, -1, 0, 2, 3 });
+
+        std::vector<std::string> strings = { "c", "a", "b" };
+        lz::sortInPlace(strings);
+        CHECK(strings == std::vector<std::string>{ "a", "b", "c" });
+    }
+
+    SECTION("Sorted vector of floating points") {
+        std::vector<double> doubles;
+        for (long long value : big) {
+            doubles.push_back(static_cast<double>(value) / 1000.);
+        }
+        doubles.push_back(-0.5);
+        doubles.push_back(0.25);
+        auto sorted = lz::sortedVector(doubles);
+        std::sort(doubles.begin(), doubles.end());
+        CHECK(sorted == doubles);
+    }
+
+    SECTION("Sorted vector by key should be stable") {
+        std::vector<std::pair<unsigned char, std::size_t>> pairs;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            pairs.emplace_back(static_cast<unsigned char>(i * 37 % 5), i);
+        }
+        auto sorted = lz::sortedVector(pairs, [](const std::pair<unsigned char, std::size_t>& p) { return p.first; });
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+
+        std::list<std::string> words = { "ccc", "a", "bb", "d" };
+        auto bySize = lz::sortedVector(words, [](const std::string& s) { return s.size(); });
+        CHECK(bySize == std::vector<std::string>{ "a", "d", "bb", "ccc" });
+        auto byValue = lz::sortedVector(words, [](const std::string& s) { return s; });
+        CHECK(byValue == std::vector<std::string>{ "a", "bb", "ccc", "d" });
+    }
+
+    SECTION("Argsort") {
+        std::vector<float> floats = { 2.5f, -1.f, 0.f, -3.5f };
+        CHECK(lz::argsort(floats, [](const float f) { return f; }) == std::vector<std::size_t>{ 3, 1, 2, 0 });
+
+        auto indices = lz::argsort(big, [](const long long value) { return value; });
+        std::vector<long long> gathered;
+        for (const std::size_t index : indices) {
+            gathered.push_back(big[index]);
+        }
+        CHECK(gathered == expected);
+    }
+
+    SECTION("Multiple partitions should equal a single one") {
+        std::vector<long long> copy = big;
+        lz::internal::sortInPlace(copy.begin(), copy.end(), FourPartitions());
+        CHECK(copy == expected);
+
+        std::vector<std::pair<std::uint32_t, std::size_t>> items;
+        for (std::size_t i = 0; i < big.size(); ++i) {
+            items.emplace_back(static_cast<std::uint32_t>(big[i]) % 1000, i);
+        }
+        lz::internal::radixSort(items, lz::internal::PairFirst(), FourPartitions());
+        CHECK(std::is_sorted(items.begin(), items.end()));
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Parallel should equal sequential") {
+        std::vector<long long> copy = big;
+        lz::sortInPlace(copy, std::execution::par);
+        CHECK(copy == expected);
+        CHECK(lz::sortedVector(big, std::execution::par) == expected);
+        auto key = [](const long long value) { return value % 1000; };
+        CHECK(lz::sortedVector(big, key, std::execution::par) == lz::sortedVector(big, key));
+        CHECK(lz::argsort(big, key, std::execution::par) == lz::argsort(big, key));
+    }
+#endif
+}
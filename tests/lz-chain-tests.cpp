@@ -1,6 +1,7 @@
 #include "Lz/Lz.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <catch2/catch.hpp>
 #include <cctype>
 
@@ -53,6 +54,25 @@ TEST_CASE("Iterator chaining") {
         CHECK(joined == "0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15");
     }
 
+    SECTION("MapBatch") {
+        auto halves = lz::chain(arr).mapBatch<double>(
+            [](const int* in, double* out, std::size_t count) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = in[i] / 2.;
+                }
+            },
+            5);
+        CHECK(halves.distance() == size);
+        CHECK(halves.toVector().back() == 7.5);
+    }
+
+    SECTION("Expression") {
+        auto doubled = (lz::chain(arr) * 2 + lz::chain(arr2)).toVector();
+        CHECK(doubled.size() == static_cast<std::size_t>(size));
+        CHECK(doubled.front() == 0);
+        CHECK(doubled.back() == 45);
+    }
+
     SECTION("Slice") {
         auto sliced = lz::chain(arr).slice(0, 5).toArray<5>();
         CHECK(sliced == lz::range(0, 5).toArray<5>());
@@ -142,6 +162,66 @@ TEST_CASE("Iterator chaining") {
         CHECK(lz::chain(arr).filter([](int i) { return i % 2 == 0; }).distance() == 8);
     }
 
+    SECTION("FilterBatch") {
+        auto evens = lz::chain(arr).filterBatch([](const int* block, std::size_t count) {
+            std::uint64_t mask = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                mask |= static_cast<std::uint64_t>(block[i] % 2 == 0) << i;
+            }
+            return mask;
+        });
+        CHECK(evens.distance() == 8);
+    }
+
+    SECTION("Cache") {
+        int calls = 0;
+        auto cached = lz::chain(arr).take(4).map([&calls](const int i) {
+            ++calls;
+            return i + 1;
+        });
+        auto twice = cached.cache();
+        CHECK(twice.toVector() == twice.toVector());
+        CHECK(calls == 4);
+        calls = 0;
+        std::vector<int> evens;
+        for (const int i : cached.cacheLast().filter([](const int i) { return i % 2 == 0; })) {
+            evens.push_back(i);
+        }
+        CHECK(evens == std::vector<int>{ 2, 4 });
+        CHECK(calls == 4);
+    }
+
+    SECTION("Sliding") {
+        CHECK(lz::chain(arr).take(4).slidingSum(2).toVector() == std::vector<int>{ 1, 3, 5 });
+        CHECK(lz::chain(arr).take(4).slidingMean(2).toVector() == std::vector<double>{ 0.5, 1.5, 2.5 });
+        CHECK(lz::chain(arr).take(4).slidingMin(3).toVector() == std::vector<int>{ 0, 1 });
+        CHECK(lz::chain(arr).take(4).slidingMax(3).toVector() == std::vector<int>{ 2, 3 });
+    }
+
+    SECTION("Window") {
+        auto sums = lz::chain(arr).take(4).window(3).map([](const lz::Window<const int*>::value_type& w) {
+            return lz::chain(w).sum();
+        });
+        CHECK(sums.toVector() == std::vector<int>{ 3, 6 });
+    }
+
+    SECTION("MergeSorted") {
+        std::array<int, 3> odds = { 1, 3, 5 };
+        auto merged = lz::chain(arr).take(6).mergeSorted(std::less<int>(), odds);
+        CHECK(merged.toVector() == std::vector<int>{ 0, 1, 1, 2, 3, 3, 4, 5, 5 });
+    }
+
+    SECTION("Sorted") {
+        auto descending = lz::chain(arr).sorted(std::greater<int>());
+        CHECK(descending.front() == 15);
+        CHECK(descending.take(3).toVector() == std::vector<int>{ 15, 14, 13 });
+    }
+
+    SECTION("ExternalSort") {
+        auto descending = lz::chain(arr).externalSort(std::greater<int>(), 4 * sizeof(int));
+        CHECK(descending.toVector() == lz::chain(arr).reverse().toVector());
+    }
+
     SECTION("Except") {
         CHECK(lz::chain(arr).except(arr2).distance() == 0);
     }
@@ -159,6 +239,67 @@ TEST_CASE("Iterator chaining") {
               "0 2 4 6 8 10 12 14");
     }
 
+    SECTION("FilterMapOpt") {
+        auto evens = lz::chain(arr).take(6).filterMapOpt([](const int& i) { return i % 2 == 0 ? &i : nullptr; });
+        CHECK(evens.toVector() == std::vector<int>{ 0, 2, 4 });
+    }
+
+    SECTION("Parallel") {
+        auto chain = lz::chain(arr);
+        CHECK(chain.splitInto(4).size() == 4);
+        CHECK(chain.parallelToVector(4) == chain.toVector());
+        CHECK(chain.parallelFoldl(0, std::plus<int>(), 4) == chain.sum());
+        CHECK(chain.parallelCount(3, 4) == 1);
+        CHECK(chain.parallelCountIf([](const int i) { return i % 2 == 0; }, 4) == 8);
+        std::atomic<int> sum(0);
+        chain.parallelForEach([&sum](const int i) { sum += i; }, 4);
+        CHECK(sum == chain.sum());
+        lz::ThreadPool pool(2);
+        CHECK(chain.parallelToVector(3, pool) == chain.toVector());
+        std::atomic<int> evens(0);
+        chain.filter([](const int i) { return i % 2 == 0; })
+            .parallelForEachChunked([&evens](const int i) { evens += i; }, 3, 2, pool);
+        CHECK(evens == 56);
+        CHECK(chain.parallelMap([](const int i) { return i * 2; }, 3, pool).toVector() ==
+              chain.map([](const int i) { return i * 2; }).toVector());
+        CHECK(chain.parallelMapUnordered([](const int i) { return i * 2; }, 3, pool).sum() == 2 * chain.sum());
+        CHECK(chain.asyncBuffer(4).toVector() == chain.toVector());
+        CHECK(chain.parallelSumDeterministic(4, 3) == chain.sum());
+        CHECK(chain.parallelFoldlDeterministic(0, std::plus<int>(), 4, 3, pool) == chain.sum());
+        std::vector<int> small;
+        std::vector<int> large;
+        chain.parallelPartitionTo(small, large, [](const int i) { return i < 4; }, 3, pool);
+        CHECK(small == std::vector<int>{ 0, 1, 2, 3 });
+        CHECK(large.size() == 12);
+        std::vector<int> indices;
+        std::vector<int> values;
+        chain.enumerate().parallelUnzipTo(std::tie(indices, values), 3, pool);
+        CHECK(indices == values);
+    }
+
+    SECTION("Partition and unzip") {
+        auto chain = lz::chain(arr);
+        std::vector<int> evens;
+        std::vector<int> odds;
+        chain.partitionTo(evens, odds, [](const int i) { return i % 2 == 0; });
+        CHECK(evens.size() == 8);
+        CHECK(odds.front() == 1);
+        std::vector<int> indices;
+        std::vector<int> values;
+        chain.enumerate().unzipTo(indices, values);
+        CHECK(indices == values);
+    }
+
+    SECTION("Tee") {
+        auto chain = lz::chain(arr);
+        auto views = chain.tee(2);
+        CHECK(views[0].toVector() == chain.toVector());
+        CHECK(views[1].toVector() == chain.toVector());
+        int count = 0;
+        chain.fanout([&count](int) { ++count; });
+        CHECK(count == 16);
+    }
+
     SECTION("Select") {
         std::function<bool(int)> selFunc = [](int i) {
             return i % 2 == 0;
@@ -208,11 +349,23 @@ TEST_CASE("Iterator chaining") {
         CHECK(lz::chain(arr).any([](int i) { return i == 0; }));
         CHECK(lz::chain(arr).none([](int i) { return i == 16; }));
         CHECK(lz::chain(arr).count(0) == 1);
+        std::vector<unsigned char> bytes = { 1, 2, 1, 1, 3, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 255 };
+        CHECK(lz::chain(bytes).count(1) == 14);
+        CHECK(lz::chain(bytes).count(-1) == 0);
         CHECK(lz::chain(arr).countIf([](int i) { return i == 0; }) == 1);
         CHECK(lz::chain(arr).equal(lz::range(size)));
         CHECK(lz::chain(arr).sum() == 120);
         CHECK(lz::chain(arr).mean() == 7.5);
         CHECK(lz::chain(arr).median() == 7.5);
+        auto stats = lz::chain(arr).stats();
+        CHECK(stats.count() == static_cast<std::size_t>(size));
+        CHECK(stats.mean() == 7.5);
+        CHECK(stats.max() == 15);
+        CHECK(lz::chain(arr).quantiles({ 0., 1. }) == std::vector<double>{ 0., 15. });
+        CHECK(lz::chain(arr).approxQuantiles({ 0., 1. }) == std::vector<int>{ 0, 15 });
+        CHECK(lz::chain(arr).topK(2) == std::vector<int>{ 15, 14 });
+        CHECK(lz::chain(arr).bottomK(2) == std::vector<int>{ 0, 1 });
+        CHECK(lz::chain(arr).topKBy(1, [](int i) { return i % 5; }).front() % 5 == 4);
     }
 
     SECTION("Max/min") {
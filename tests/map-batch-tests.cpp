@@ -0,0 +1,125 @@
+#include <Lz/MapBatch.hpp>
+#include <Lz/Range.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+namespace {
+struct Halve {
+    std::size_t* calls;
+
+    void operator()(const int* in, double* out, const std::size_t count) const {
+        ++*calls;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = in[i] / 2.;
+        }
+    }
+};
+} // namespace
+
+TEST_CASE("MapBatch changing and creating elements", "[MapBatch][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7 };
+    std::size_t calls = 0;
+
+    SECTION("Should transform per block") {
+        auto map = lz::mapBatch<double>(vec, Halve{ &calls }, 3);
+        CHECK(map.toVector() == std::vector<double>{ .5, 1., 1.5, 2., 2.5, 3., 3.5 });
+        CHECK(calls == 3);
+    }
+
+    SECTION("Should default to the value type") {
+        auto map = lz::mapBatch(vec, [](const int* in, int* out, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = in[i] * 2;
+            }
+        });
+        static_assert(std::is_same<decltype(*map.begin()), int>::value, "");
+        CHECK(map.toVector() == std::vector<int>{ 2, 4, 6, 8, 10, 12, 14 });
+    }
+
+    SECTION("Should only transform dereferenced blocks") {
+        auto map = lz::mapBatch<double>(vec, Halve{ &calls }, 2);
+        auto it = map.begin();
+        std::advance(it, 5);
+        CHECK(*it == 3.);
+        CHECK(calls == 1);
+    }
+
+    SECTION("Should work with non contiguous sequences") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto map = lz::mapBatch<double>(list, Halve{ &calls }, 4);
+        CHECK(map.toVector() == std::vector<double>{ .5, 1., 1.5, 2., 2.5, 3., 3.5 });
+        CHECK(calls == 2);
+    }
+
+    SECTION("Copies should share the transformed block") {
+        auto map = lz::mapBatch<double>(vec, Halve{ &calls }, 4);
+        auto it = map.begin();
+        CHECK(*it == .5);
+        auto copy = it++;
+        CHECK(*copy == .5);
+        CHECK(*it == 1.);
+        CHECK(calls == 1);
+        std::advance(it, 3);
+        CHECK(*it == 2.5);
+        CHECK(calls == 2);
+        CHECK(*copy == .5);
+        CHECK(calls == 3);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto map = lz::mapBatch<double>(empty, Halve{ &calls });
+        CHECK(map.begin() == map.end());
+        CHECK(calls == 0);
+    }
+}
+
+TEST_CASE("MapBatch binary operations", "[MapBatch][Binary ops]") {
+    std::array<int, 4> array = { 2, 4, 6, 8 };
+    std::size_t calls = 0;
+    auto map = lz::mapBatch<double>(array, Halve{ &calls }, 3);
+    auto it = map.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 1.);
+        ++it;
+        CHECK(*it == 2.);
+        ++it;
+        ++it;
+        CHECK(*it == 4.);
+        ++it;
+        CHECK(it == map.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != map.end());
+        it = map.end();
+        CHECK(it == map.end());
+    }
+}
+
+TEST_CASE("MapBatch to containers", "[MapBatch][To container]") {
+    std::vector<int> vec = { 2, 4, 6 };
+    std::size_t calls = 0;
+    auto map = lz::mapBatch<double>(vec, Halve{ &calls }, 2);
+
+    SECTION("To array") {
+        CHECK(map.toArray<3>() == std::array<double, 3>{ 1., 2., 3. });
+    }
+
+    SECTION("To list") {
+        CHECK(map.to<std::list>() == std::list<double>{ 1., 2., 3. });
+    }
+
+    SECTION("To map") {
+        std::map<double, double> actual = map.toMap([](const double d) { return d; });
+        CHECK(actual == std::map<double, double>{ { 1., 1. }, { 2., 2. }, { 3., 3. } });
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<double, double> actual = map.toUnorderedMap([](const double d) { return d; });
+        CHECK(actual == std::unordered_map<double, double>{ { 1., 1. }, { 2., 2. }, { 3., 3. } });
+    }
+}
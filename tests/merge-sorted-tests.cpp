@@ -0,0 +1,115 @@
+#include <Lz/Map.hpp>
+#include <Lz/MergeSorted.hpp>
+#include <catch2/catch.hpp>
+#include <functional>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+TEST_CASE("MergeSorted with a fixed amount of sequences", "[MergeSorted][Basic functionality]") {
+    std::vector<int> a = { 1, 4, 7, 10 };
+    std::list<int> b = { 2, 5, 8 };
+    std::array<int, 4> c = { 0, 3, 6, 9 };
+
+    SECTION("Should merge different sequence types") {
+        auto merged = lz::mergeSorted(std::less<int>(), a, b, c);
+        CHECK(merged.toVector() == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 });
+        CHECK(merged.distance() == 11);
+    }
+
+    SECTION("Should use a custom comparer") {
+        std::vector<int> x = { 9, 5, 1 };
+        std::vector<int> y = { 8, 4 };
+        CHECK(lz::mergeSorted(std::greater<int>(), x, y).toVector() == std::vector<int>{ 9, 8, 5, 4, 1 });
+    }
+
+    SECTION("Should handle empty sequences") {
+        std::vector<int> empty;
+        CHECK(lz::mergeSorted(std::less<int>(), empty, a, empty).toVector() == a);
+        CHECK(lz::mergeSorted(std::less<int>(), empty, empty).toVector().empty());
+    }
+
+    SECTION("Should be stable") {
+        using Pair = std::pair<int, char>;
+        std::vector<Pair> x = { { 1, 'a' }, { 2, 'a' } };
+        std::vector<Pair> y = { { 1, 'b' }, { 2, 'b' } };
+        auto byFirst = [](const Pair& l, const Pair& r) { return l.first < r.first; };
+        auto merged = lz::mergeSorted(byFirst, y, x).toVector();
+        CHECK(merged == std::vector<Pair>{ { 1, 'b' }, { 1, 'a' }, { 2, 'b' }, { 2, 'a' } });
+    }
+
+    SECTION("Should collapse duplicates") {
+        std::vector<int> x = { 1, 1, 2, 4 };
+        std::vector<int> y = { 1, 2, 3, 4, 4 };
+        CHECK(lz::mergeSortedUnique(std::less<int>(), x, y).toVector() == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Should work with lazy sequences") {
+        std::function<int(int)> twice = [](const int i) { return i * 2; };
+        auto doubled = lz::map(a, std::move(twice));
+        CHECK(lz::mergeSorted(std::less<int>(), doubled, c).toVector() == std::vector<int>{ 0, 2, 3, 6, 8, 9, 14, 20 });
+    }
+}
+
+TEST_CASE("MergeSorted with a runtime amount of sequences", "[MergeSorted][Binary ops]") {
+    std::vector<std::vector<int>> shards(37);
+    for (int i = 0; i < 1000; ++i) {
+        shards[static_cast<std::size_t>(i * 7) % shards.size()].push_back(i);
+    }
+
+    SECTION("Should merge all shards") {
+        auto merged = lz::mergeSorted(shards).toVector();
+        REQUIRE(merged.size() == 1000);
+        CHECK(std::is_sorted(merged.begin(), merged.end()));
+        CHECK(merged.front() == 0);
+        CHECK(merged.back() == 999);
+    }
+
+    SECTION("Should collapse duplicates") {
+        std::vector<std::vector<int>> copies = { { 1, 2, 3 }, { 1, 2, 3 }, { 2, 3, 4 } };
+        CHECK(lz::mergeSortedUnique(copies).toVector() == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Should handle no sequences") {
+        CHECK(lz::mergeSorted(std::vector<std::vector<int>>()).toVector().empty());
+    }
+
+    SECTION("Iterators should compare equal at the same position") {
+        auto merged = lz::mergeSorted(shards);
+        auto it = merged.begin();
+        auto copy = it;
+        CHECK(it == copy);
+        ++it;
+        CHECK(it != copy);
+        ++copy;
+        CHECK(it == copy);
+    }
+}
+
+TEST_CASE("MergeSorted to containers", "[MergeSorted][To container]") {
+    std::vector<int> a = { 1, 3 };
+    std::vector<int> b = { 2 };
+    auto merged = lz::mergeSorted(std::less<int>(), a, b);
+
+    SECTION("To array") {
+        CHECK(merged.toArray<3>() == std::array<int, 3>{ 1, 2, 3 });
+    }
+
+    SECTION("To vector") {
+        CHECK(merged.toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(merged.to<std::list<int>>() == std::list<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To map") {
+        std::map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(merged.toMap([](const int i) { return i; }) == expected);
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(merged.toUnorderedMap([](const int i) { return i; }) == expected);
+    }
+}
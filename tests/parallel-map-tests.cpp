@@ -0,0 +1,100 @@
+#include "Lz/ParallelMap.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Filter.hpp>
+#include <Lz/Range.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ParallelMap basic functionality", "[ParallelMap][Basic functionality]") {
+    std::vector<int> v(200);
+    std::iota(v.begin(), v.end(), 0);
+    lz::ThreadPool pool(3);
+
+    SECTION("Should keep the order") {
+        // Later elements are mapped faster, so they would be finished first if the order was not kept
+        auto mapped = lz::parallelMap(
+            v,
+            [](const int i) {
+                if (i % 10 == 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+                return i * i;
+            },
+            8, pool);
+        std::vector<int> expected;
+        for (const int i : v) {
+            expected.push_back(i * i);
+        }
+        CHECK(mapped.toVector() == expected);
+    }
+
+    SECTION("Should yield every result once if unordered") {
+        auto mapped = lz::parallelMapUnordered(v, [](const int i) { return std::to_string(i); }, 8, pool);
+        std::vector<std::string> result = mapped.toVector();
+        std::vector<std::string> expected;
+        for (const int i : v) {
+            expected.push_back(std::to_string(i));
+        }
+        std::sort(result.begin(), result.end());
+        std::sort(expected.begin(), expected.end());
+        CHECK(result == expected);
+    }
+
+    SECTION("Should not map more elements ahead than the window") {
+        std::atomic<int> started(0);
+        auto mapped = lz::parallelMap(
+            v,
+            [&started](const int i) {
+                ++started;
+                return i;
+            },
+            4, pool);
+        auto it = mapped.begin();
+        CHECK(*it == 0);
+        CHECK(started <= 4);
+        ++it;
+        CHECK(*it == 1);
+        CHECK(started <= 5);
+    }
+
+    SECTION("Should map non splittable and input sequences") {
+        auto evens = lz::filter(v, [](const int i) { return i % 2 == 0; });
+        CHECK(lz::parallelMap(evens, [](const int i) { return i / 2; }, 0, pool).toVector() ==
+              lz::range(100).toVector());
+
+        std::istringstream stream("1 2 3 4 5");
+        auto mapped = lz::parallelMapRange(std::istream_iterator<int>(stream), std::istream_iterator<int>(),
+                                           [](const int i) { return i * 10; }, 2, pool);
+        CHECK(mapped.toVector() == std::vector<int>{ 10, 20, 30, 40, 50 });
+    }
+
+    SECTION("Should rethrow exceptions when the element is reached") {
+        auto mapped = lz::parallelMap(
+            v,
+            [](const int i) {
+                if (i == 50) {
+                    throw std::runtime_error("");
+                }
+                return i;
+            },
+            8, pool);
+        int count = 0;
+        CHECK_THROWS_AS(std::for_each(mapped.begin(), mapped.end(), [&count](int) { ++count; }), std::runtime_error);
+        CHECK(count == 50);
+    }
+
+    SECTION("Should be empty for empty sequences") {
+        std::vector<int> empty;
+        auto mapped = lz::parallelMap(empty, [](const int i) { return i; }, 0, pool);
+        CHECK(mapped.begin() == mapped.end());
+    }
+}
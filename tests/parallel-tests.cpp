@@ -0,0 +1,322 @@
+#include "Lz/Parallel.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Cache.hpp>
+#include <Lz/Concatenate.hpp>
+#include <Lz/Enumerate.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
+#include <Lz/Zip.hpp>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+struct NotDefaultConstructible {
+    explicit NotDefaultConstructible(const int i) : value(i) {
+    }
+
+    int value;
+
+    bool operator==(const NotDefaultConstructible& other) const {
+        return value == other.value;
+    }
+};
+
+TEST_CASE("Split basic functionality", "[Parallel][Basic functionality]") {
+    std::vector<int> v(10);
+    std::iota(v.begin(), v.end(), 0);
+
+    SECTION("Should split in parts of almost equal size, in order") {
+        auto parts = lz::splitInto(v, 3);
+        REQUIRE(parts.size() == 3);
+        CHECK(parts[0].toVector() == std::vector<int>{ 0, 1, 2, 3 });
+        CHECK(parts[1].toVector() == std::vector<int>{ 4, 5, 6 });
+        CHECK(parts[2].toVector() == std::vector<int>{ 7, 8, 9 });
+    }
+
+    SECTION("Should not return more parts than elements") {
+        CHECK(lz::splitInto(v, 20).size() == 10);
+        CHECK(lz::splitInto(v, 0).size() == 1);
+        std::vector<int> empty;
+        auto parts = lz::splitInto(empty, 4);
+        REQUIRE(parts.size() == 1);
+        CHECK(parts[0].begin() == parts[0].end());
+    }
+
+    SECTION("Should split chains") {
+        std::vector<int> w(10, 1);
+        std::function<int(std::tuple<int&, int&>)> add = [](std::tuple<int&, int&> t) {
+            return std::get<0>(t) + std::get<1>(t);
+        };
+        auto zipped = lz::map(lz::zip(v, w), std::move(add));
+        auto parts = lz::splitInto(zipped, 4);
+        REQUIRE(parts.size() == 4);
+        CHECK(parts[0].toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(parts[3].toVector() == std::vector<int>{ 9, 10 });
+    }
+
+    SECTION("Should not split cached views") {
+        auto cached = lz::cache(v);
+        auto cachedLast = lz::cacheLast(lz::map(v, [](const int i) { return i * 2; }));
+        static_assert(!lz::internal::IsSplittable<decltype(cached.begin())>::value, "Cache iterators share their storage");
+        static_assert(!lz::internal::IsSplittable<decltype(cachedLast.begin())>::value, "Cache iterators share their storage");
+        CHECK(lz::parallelFoldl(cachedLast, 0, std::plus<int>(), 4) == 90);
+        CHECK(lz::parallelToVector(cached, 4) == v);
+    }
+}
+
+TEST_CASE("Parallel forEach", "[Parallel][Basic functionality]") {
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+
+    SECTION("Should visit every element once") {
+        std::vector<int> visited(v.size());
+        lz::parallelForEach(v, [&visited](const int i) { ++visited[static_cast<std::size_t>(i)]; }, 4);
+        CHECK(std::all_of(visited.begin(), visited.end(), [](const int i) { return i == 1; }));
+    }
+
+    SECTION("Should process non splittable views on the calling thread") {
+        std::list<int> list(v.begin(), v.end());
+        std::atomic<int> sum(0);
+        lz::parallelForEach(list, [&sum](const int i) { sum += i; }, 4);
+        CHECK(sum == 499500);
+    }
+
+    SECTION("Should mutate the elements of non splittable views") {
+        std::vector<int> w = { 1, 2, 3, 4, 5, 6 };
+        lz::parallelForEach(lz::filter(w, [](const int i) { return i % 2 == 0; }), [](int& i) { i *= 10; }, 4);
+        CHECK(w == std::vector<int>{ 1, 20, 3, 40, 5, 60 });
+    }
+
+    SECTION("Should rethrow exceptions") {
+        CHECK_THROWS_AS(lz::parallelForEach(
+                            v,
+                            [](const int i) {
+                                if (i == 900) {
+                                    throw std::runtime_error("");
+                                }
+                            },
+                            4),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("Parallel chunked forEach", "[Parallel][Basic functionality]") {
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+    auto evens = lz::filter(v, [](const int i) { return i % 2 == 0; });
+
+    SECTION("Should visit every element once") {
+        std::vector<std::atomic<int>> visited(v.size());
+        lz::parallelForEachChunked(evens, [&visited](const int i) { ++visited[static_cast<std::size_t>(i)]; }, 7, 3);
+        for (std::size_t i = 0; i < visited.size(); ++i) {
+            CHECK(visited[i] == (i % 2 == 0 ? 1 : 0));
+        }
+    }
+
+    SECTION("Should visit every element of input iterators once") {
+        std::istringstream stream("1 2 3 4 5 6 7 8 9 10");
+        std::atomic<int> sum(0);
+        lz::parallelForEachChunked(
+            lz::internal::BasicIteratorView<std::istream_iterator<int>>(std::istream_iterator<int>(stream),
+                                                                       std::istream_iterator<int>()),
+            [&sum](const int i) { sum += i; }, 3);
+        CHECK(sum == 55);
+    }
+
+    SECTION("Should use the given pool") {
+        lz::ThreadPool pool(2);
+        std::atomic<int> count(0);
+        lz::parallelForEachChunked(evens, [&count](int) { ++count; }, 1, 1, pool);
+        CHECK(count == 500);
+    }
+
+    SECTION("Should rethrow exceptions") {
+        CHECK_THROWS_AS(lz::parallelForEachChunked(evens,
+                                                   [](const int i) {
+                                                       if (i == 500) {
+                                                           throw std::runtime_error("");
+                                                       }
+                                                   }),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("Parallel foldl", "[Parallel][Basic functionality]") {
+    SECTION("Should fold ranges") {
+        auto range = lz::range(1, 10001);
+        const auto sum = lz::parallelFoldl(range, 0LL, [](const long long acc, const long long i) { return acc + i; }, 8);
+        CHECK(sum == 50005000LL);
+    }
+
+    SECTION("Should combine the parts in order") {
+        std::vector<std::string> v = { "a", "b", "c", "d", "e", "f", "g" };
+        const auto concat = [](std::string acc, const std::string& s) {
+            return acc + s;
+        };
+        CHECK(lz::parallelFoldl(v, std::string(), concat, concat, 3) == "abcdefg");
+    }
+
+    SECTION("Should return init for empty sequences") {
+        std::vector<int> empty;
+        CHECK(lz::parallelFoldl(empty, 0, std::plus<int>(), 4) == 0);
+    }
+
+    SECTION("Should fold non splittable views") {
+        std::list<int> list = { 1, 2, 3, 4 };
+        CHECK(lz::parallelFoldl(list, 0, std::plus<int>(), 4) == 10);
+    }
+}
+
+TEST_CASE("Parallel deterministic foldl", "[Parallel][Basic functionality]") {
+    std::vector<double> v(10000);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        v[i] = 1.0 / static_cast<double>(i + 1) * (i % 2 == 0 ? 1e8 : -1e-8);
+    }
+
+    SECTION("Should not depend on the amount of parts or the executor") {
+        const double expected = lz::parallelSumDeterministic(v, 64, 1);
+        lz::ThreadPool pool(3);
+        for (std::size_t parts = 2; parts <= 16; ++parts) {
+            CHECK(lz::parallelSumDeterministic(v, 64, parts) == expected);
+            CHECK(lz::parallelSumDeterministic(v, 64, parts, pool) == expected);
+        }
+    }
+
+    SECTION("Should not depend on whether the view can be split") {
+        std::list<double> list(v.begin(), v.end());
+        CHECK(lz::parallelSumDeterministic(list, 100, 4) == lz::parallelSumDeterministic(v, 100, 7));
+    }
+
+    SECTION("Should fold blocks from left to right and combine them as a tree") {
+        std::vector<std::string> strings = { "a", "b", "c", "d", "e", "f", "g" };
+        const auto concat = [](std::string acc, const std::string& s) {
+            return acc + s;
+        };
+        const auto combine = [](const std::string& a, const std::string& b) {
+            return "(" + a + b + ")";
+        };
+        CHECK(lz::parallelFoldlDeterministic(strings, std::string(), concat, combine, 2, 3) == "((abcd)(efg))");
+        CHECK(lz::parallelFoldlDeterministic(strings, std::string(), concat, 3, 2) == "abcdefg");
+    }
+
+    SECTION("Should return init for empty sequences") {
+        std::vector<int> empty;
+        CHECK(lz::parallelFoldlDeterministic(empty, 5, std::plus<int>()) == 5);
+        CHECK(lz::parallelSumDeterministic(empty) == 0);
+    }
+}
+
+TEST_CASE("Parallel toVector", "[Parallel][To container]") {
+    std::vector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+
+    SECTION("Should keep the order") {
+        std::function<int(int)> square = [](const int i) {
+            return i * i;
+        };
+        std::vector<int> expected;
+        for (const int i : v) {
+            expected.push_back(i * i);
+        }
+        CHECK(lz::parallelToVector(lz::map(v, std::move(square)), 7) == expected);
+    }
+
+    SECTION("Should concatenate values that are not default constructible") {
+        std::function<NotDefaultConstructible(int)> make = [](const int i) {
+            return NotDefaultConstructible(i);
+        };
+        auto result = lz::parallelToVector(lz::map(v, std::move(make)), 3);
+        REQUIRE(result.size() == v.size());
+        CHECK(result.front() == NotDefaultConstructible(0));
+        CHECK(result.back() == NotDefaultConstructible(99));
+    }
+
+    SECTION("Should evaluate non splittable views") {
+        auto filtered = lz::filter(v, [](const int i) { return i % 10 == 0; });
+        CHECK(lz::parallelToVector(filtered, 4) == std::vector<int>{ 0, 10, 20, 30, 40, 50, 60, 70, 80, 90 });
+    }
+
+    SECTION("Should evaluate concatenated views") {
+        std::vector<int> w = { 100, 101 };
+        auto result = lz::parallelToVector(lz::concat(v, w), 4);
+        REQUIRE(result.size() == 102);
+        CHECK(result[99] == 99);
+        CHECK(result[101] == 101);
+    }
+}
+
+TEST_CASE("Parallel count", "[Parallel][Basic functionality]") {
+    auto range = lz::range(0, 1000);
+
+    SECTION("Should count values") {
+        std::vector<int> v = { 1, 2, 1, 1, 3, 1 };
+        CHECK(lz::parallelCount(v, 1, 3) == 4);
+    }
+
+    SECTION("Should count values for which the predicate returns true") {
+        CHECK(lz::parallelCountIf(range, [](const int i) { return i % 3 == 0; }, 6) == 334);
+    }
+
+    SECTION("Should count enumerated views") {
+        auto enumerated = lz::enumerate(range);
+        CHECK(lz::parallelCountIf(enumerated, [](const std::pair<int, int>& p) { return p.first == p.second; }, 5) == 1000);
+    }
+}
+
+TEST_CASE("Parallel partition and unzip", "[Parallel][To container]") {
+    std::vector<int> v(1000);
+    std::iota(v.begin(), v.end(), 0);
+    lz::ThreadPool pool(3);
+
+    SECTION("Should partition in order and reserve exactly") {
+        std::vector<int> evens;
+        std::vector<int> odds = { -1 };
+        lz::parallelPartitionTo(v, evens, odds, [](const int i) { return i % 2 == 0; }, 7, pool);
+        REQUIRE(evens.size() == 500);
+        CHECK(evens.capacity() == 500);
+        CHECK(odds.size() == 501);
+        CHECK(odds.capacity() == 501);
+        CHECK(evens == lz::range(0, 1000, 2).toVector());
+        std::vector<int> expectedOdds = lz::range(-1, 1000, 2).toVector();
+        CHECK(odds == expectedOdds);
+    }
+
+    SECTION("Should partition non splittable views") {
+        auto filtered = lz::filter(v, [](const int i) { return i < 10; });
+        std::vector<int> small;
+        std::vector<int> large;
+        lz::parallelPartitionTo(filtered, small, large, [](const int i) { return i < 5; }, 4);
+        CHECK(small == std::vector<int>{ 0, 1, 2, 3, 4 });
+        CHECK(large == std::vector<int>{ 5, 6, 7, 8, 9 });
+    }
+
+    SECTION("Should unzip in order and reserve exactly") {
+        std::function<std::string(int)> toString = [](const int i) {
+            return std::to_string(i);
+        };
+        std::vector<int> ints;
+        std::vector<std::string> strings;
+        lz::parallelUnzipTo(lz::zip(v, lz::map(v, std::move(toString))), std::tie(ints, strings), 5, pool);
+        CHECK(ints == v);
+        CHECK(ints.capacity() == 1000);
+        REQUIRE(strings.size() == 1000);
+        CHECK(strings.capacity() == 1000);
+        CHECK(strings[999] == "999");
+    }
+
+    SECTION("Should unzip non splittable views") {
+        std::list<std::pair<int, char>> pairs = { { 1, 'a' }, { 2, 'b' } };
+        std::vector<int> ints;
+        std::string chars;
+        lz::parallelUnzipTo(pairs, std::tie(ints, chars), 4);
+        CHECK(ints == std::vector<int>{ 1, 2 });
+        CHECK(chars == "ab");
+    }
+}
@@ -0,0 +1,79 @@
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Quantiles.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Exact quantiles", "[Quantiles][Basic functionality]") {
+    std::vector<int> vec = { 9, 1, 8, 2, 7, 3, 6, 4, 5, 10 };
+    const std::vector<int> copy = vec;
+
+    SECTION("Should interpolate between ranks") {
+        auto q = lz::quantiles(vec, { 0., 0.5, 1., 0.25 });
+        CHECK(q == std::vector<double>{ 1., 5.5, 10., 3.25 });
+    }
+
+    SECTION("Should not modify the sequence") {
+        static_cast<void>(lz::quantiles(vec, { 0.9, 0.1 }));
+        CHECK(vec == copy);
+    }
+
+    SECTION("Should equal median") {
+        CHECK(lz::quantiles(vec, { 0.5 }).front() == Approx(5.5));
+        vec.push_back(11);
+        CHECK(lz::quantiles(vec, { 0.5 }).front() == Approx(6.));
+    }
+
+    SECTION("Should work with lazy input sequences") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto evens = lz::filter(list, [](const int i) { return i % 2 == 0; });
+        CHECK(lz::quantiles(evens, { 0., 0.5, 1. }) == std::vector<double>{ 2., 6., 10. });
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Parallel should equal sequential") {
+        CHECK(lz::quantiles(vec, { 0.99, 0.5, 0.1 }, std::execution::par) == lz::quantiles(vec, { 0.99, 0.5, 0.1 }));
+    }
+#endif
+}
+
+TEST_CASE("Approximate quantiles", "[Quantiles][Binary ops]") {
+    std::vector<int> vec(100000);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % vec.size());
+    }
+
+    SECTION("Should use bounded memory") {
+        auto sketch = lz::kllSketch(vec, 200);
+        CHECK(sketch.count() == vec.size());
+        CHECK(sketch.retained() < 1000);
+    }
+
+    SECTION("Should be close to the exact quantiles") {
+        auto q = lz::approxQuantiles(vec, { 0.5, 0.9, 0.99 });
+        REQUIRE(q.size() == 3);
+        CHECK(q[0] == Approx(50000).margin(2000));
+        CHECK(q[1] == Approx(90000).margin(2000));
+        CHECK(q[2] == Approx(99000).margin(2000));
+    }
+
+    SECTION("Should be exact for small sequences") {
+        std::vector<int> small = { 5, 1, 4, 2, 3 };
+        CHECK(lz::approxQuantiles(small, { 0., 0.5, 1. }) == std::vector<int>{ 1, 3, 5 });
+    }
+
+    SECTION("Merging partitions should approximate the whole") {
+        const auto half = static_cast<std::ptrdiff_t>(vec.size() / 2);
+        auto left = lz::kllSketch(vec.begin(), vec.begin() + half);
+        auto right = lz::kllSketch(vec.begin() + half, vec.end());
+        left.merge(right);
+        CHECK(left.count() == vec.size());
+        CHECK(left.retained() < 1000);
+        CHECK(left.quantile(0.5) == Approx(50000).margin(2000));
+    }
+
+    SECTION("Should work with lazy sequences") {
+        auto map = lz::map(vec, [](const int i) { return static_cast<double>(i) / 1000.; });
+        CHECK(lz::approxQuantiles(map, { 0.5 }).front() == Approx(50.).margin(2.));
+    }
+}
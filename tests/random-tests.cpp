@@ -1,6 +1,10 @@
+#include <Lz/Parallel.hpp>
 #include <Lz/Random.hpp>
 #include <catch2/catch.hpp>
+#include <algorithm>
 #include <list>
+#include <thread>
+#include <vector>
 
 TEST_CASE("Random should be random", "[Random][Basic functionality]") {
     constexpr std::size_t size = 5;
@@ -38,6 +42,49 @@ TEST_CASE("Random with custom distro's and custom engine") {
     REQUIRE(currentRand != nextRand);
 }
 
+TEST_CASE("Random from several threads", "[Random][Basic functionality]") {
+    constexpr std::size_t size = 1000;
+
+    SECTION("Views using a generator per thread can be iterated over from several threads at once") {
+        const auto random = lz::random(0, 9, size);
+        std::vector<std::vector<int>> results(4);
+        std::vector<std::thread> threads;
+        for (std::vector<int>& result : results) {
+            threads.emplace_back([&random, &result]() { result = random.toVector(); });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        for (const std::vector<int>& result : results) {
+            REQUIRE(result.size() == size);
+            CHECK(std::all_of(result.begin(), result.end(), [](const int i) { return i >= 0 && i <= 9; }));
+        }
+    }
+
+    SECTION("Thread local random with custom distribution") {
+        auto random = lz::threadLocalRandom(std::bernoulli_distribution(1.), 3);
+        CHECK(random.toVector() == std::vector<bool>{ true, true, true });
+    }
+
+    SECTION("Clone should draw from another generator") {
+        std::mt19937 generator(42);
+        std::mt19937 other(42);
+        auto random = lz::random(std::uniform_int_distribution<int>(0, 1000), generator, 5);
+        auto clone = random.clone(other);
+        CHECK(std::distance(clone.begin(), clone.end()) == 5);
+        CHECK(clone.toVector() == random.toVector());
+    }
+
+    SECTION("Views using a user generator should not be split by the parallel functions") {
+        std::mt19937 generator(42);
+        std::mt19937 other(42);
+        auto random = lz::random(std::uniform_int_distribution<int>(0, 1000), generator, size);
+        static_assert(!lz::internal::IsSplittable<decltype(random.begin())>::value, "The generator is shared");
+        static_assert(lz::internal::IsSplittable<decltype(lz::random(0, 9, size).begin())>::value, "The generator is local");
+        CHECK(lz::parallelToVector(random, 4) == lz::random(std::uniform_int_distribution<int>(0, 1000), other, size).toVector());
+    }
+}
+
 TEST_CASE("Random binary operations", "[Random][Binary ops]") {
     constexpr std::ptrdiff_t size = 5;
     auto random = lz::random(0., 1., size);
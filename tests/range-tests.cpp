@@ -92,6 +92,9 @@ TEST_CASE("Range binary operations", "[Range][Binary ops]") {
 
         CHECK(range.end() - (it + 1) == 9);
         CHECK(fRange.end() - (fIt + 1) == 20);
+
+        CHECK(it - it == 0);
+        CHECK(range.end() - range.end() == 0);
     }
 
     SECTION("Operator[]()") {
@@ -0,0 +1,143 @@
+#include "Lz/Sliding.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Map.hpp>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <sstream>
+
+TEST_CASE("Sliding sum and mean", "[Sliding][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+
+    SECTION("Sum") {
+        CHECK(lz::slidingSum(v, 2).toVector() == std::vector<int>{ 3, 5, 7, 9 });
+        CHECK(lz::slidingSum(v, 5).toVector() == std::vector<int>{ 15 });
+        CHECK(lz::slidingSum(v, 6).toVector().empty());
+    }
+
+    SECTION("Sum of small integral types should not overflow") {
+        std::vector<unsigned char> bytes = { 200, 200, 200 };
+        CHECK(lz::slidingSum(bytes, 2).toVector() == std::vector<int>{ 400, 400 });
+    }
+
+    SECTION("Mean") {
+        CHECK(lz::slidingMean(v, 2).toVector() == std::vector<double>{ 1.5, 2.5, 3.5, 4.5 });
+    }
+
+    SECTION("Floating point sums should stay accurate") {
+        std::vector<double> values;
+        for (int i = 0; i < 100000; ++i) {
+            values.push_back(i % 2 == 0 ? 1e8 : 0.1);
+        }
+        auto sums = lz::slidingSum(values, 3).toVector();
+        REQUIRE(sums.size() == values.size() - 2);
+        CHECK(sums.back() == Approx(values[values.size() - 3] + values[values.size() - 2] + values.back()).epsilon(1e-12));
+    }
+
+    SECTION("Should dereference every element once") {
+        int calls = 0;
+        std::function<int(int)> count = [&calls](const int i) {
+            ++calls;
+            return i;
+        };
+        auto mapped = lz::map(v, std::move(count));
+        CHECK(lz::slidingSum(mapped, 3).toVector() == std::vector<int>{ 6, 9, 12 });
+        CHECK(calls == 5);
+    }
+}
+
+TEST_CASE("Sliding min and max", "[Sliding][Basic functionality]") {
+    std::vector<int> v = { 3, 1, 4, 1, 5, 9, 2, 6 };
+
+    SECTION("Min") {
+        CHECK(lz::slidingMin(v, 3).toVector() == std::vector<int>{ 1, 1, 1, 1, 2, 2 });
+        CHECK(lz::slidingMin(v, 1).toVector() == v);
+    }
+
+    SECTION("Max") {
+        CHECK(lz::slidingMax(v, 3).toVector() == std::vector<int>{ 4, 4, 5, 9, 9, 9 });
+        CHECK(lz::slidingMax(v, 8).toVector() == std::vector<int>{ 9 });
+    }
+
+    SECTION("Custom comparer") {
+        CHECK(lz::slidingMin(v, 3, std::greater<int>()).toVector() == lz::slidingMax(v, 3).toVector());
+    }
+
+    SECTION("Should equal the naive implementation") {
+        std::vector<int> many;
+        for (int i = 0; i < 500; ++i) {
+            many.push_back((i * 7919) % 101);
+        }
+        auto mins = lz::slidingMin(many, 17).toVector();
+        auto maxs = lz::slidingMax(many, 17).toVector();
+        REQUIRE(mins.size() == many.size() - 16);
+        std::vector<int> naiveMins;
+        std::vector<int> naiveMaxs;
+        for (std::size_t i = 0; i + 17 <= many.size(); ++i) {
+            naiveMins.push_back(*std::min_element(many.begin() + static_cast<std::ptrdiff_t>(i),
+                                                  many.begin() + static_cast<std::ptrdiff_t>(i + 17)));
+            naiveMaxs.push_back(*std::max_element(many.begin() + static_cast<std::ptrdiff_t>(i),
+                                                  many.begin() + static_cast<std::ptrdiff_t>(i + 17)));
+        }
+        CHECK(mins == naiveMins);
+        CHECK(maxs == naiveMaxs);
+    }
+
+    SECTION("Should work with input iterators") {
+        std::istringstream stream("5 3 8 1");
+        auto maxs = lz::slidingMaxRange(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 2);
+        CHECK(maxs.toVector() == std::vector<int>{ 5, 8, 8 });
+    }
+}
+
+TEST_CASE("Sliding binary operations", "[Sliding][Binary ops]") {
+    std::list<int> lst = { 1, 2, 3 };
+    auto sums = lz::slidingSum(lst, 2);
+    auto it = sums.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 3);
+        ++it;
+        CHECK(*it == 5);
+        ++it;
+        CHECK(it == sums.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != sums.end());
+        auto copy = it;
+        CHECK(copy == it);
+        ++copy;
+        CHECK(copy != it);
+    }
+
+    SECTION("Copies should not affect each other") {
+        auto copy = it;
+        ++copy;
+        CHECK(*copy == 5);
+        CHECK(*it == 3);
+        ++it;
+        CHECK(*it == 5);
+        ++copy;
+        CHECK(copy == sums.end());
+        CHECK(*sums.begin() == 3);
+    }
+}
+
+TEST_CASE("Sliding to containers", "[Sliding][To container]") {
+    std::vector<int> v = { 1, 2, 3 };
+    auto sums = lz::slidingSum(v, 2);
+
+    SECTION("To array") {
+        CHECK(sums.toArray<2>() == std::array<int, 2>{ 3, 5 });
+    }
+
+    SECTION("To vector") {
+        CHECK(sums.toVector() == std::vector<int>{ 3, 5 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(sums.to<std::list<int>>() == std::list<int>{ 3, 5 });
+    }
+}
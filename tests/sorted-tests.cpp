@@ -0,0 +1,96 @@
+#include <Lz/Filter.hpp>
+#include <Lz/Sorted.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+namespace {
+struct CountingLess {
+    std::size_t* comparisons;
+
+    bool operator()(const int a, const int b) const {
+        ++*comparisons;
+        return a < b;
+    }
+};
+} // namespace
+
+TEST_CASE("Sorted lazily", "[Sorted][Basic functionality]") {
+    std::vector<int> vec = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+    const std::vector<int> copy = vec;
+
+    SECTION("Should sort without modifying the sequence") {
+        auto sorted = lz::sorted(vec);
+        CHECK(sorted.toVector() == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+        CHECK(vec == copy);
+    }
+
+    SECTION("Should use a custom comparer") {
+        auto sorted = lz::sorted(vec, std::greater<int>());
+        CHECK(sorted.toVector() == std::vector<int>{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 });
+    }
+
+    SECTION("Should handle duplicates and empty sequences") {
+        std::vector<int> duplicates(100, 3);
+        duplicates[50] = 1;
+        duplicates[70] = 5;
+        auto sorted = lz::sorted(duplicates).toVector();
+        CHECK(std::is_sorted(sorted.begin(), sorted.end()));
+        CHECK(sorted.front() == 1);
+        CHECK(sorted.back() == 5);
+        CHECK(lz::sorted(std::vector<int>()).toVector().empty());
+    }
+
+    SECTION("Should work with lazy input sequences") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto odds = lz::filter(list, [](const int i) { return i % 2 != 0; });
+        CHECK(lz::sorted(odds).toVector() == std::vector<int>{ 1, 3, 5, 7, 9 });
+    }
+
+    SECTION("Should only sort what is needed") {
+        std::vector<int> many(10000);
+        for (std::size_t i = 0; i < many.size(); ++i) {
+            many[i] = static_cast<int>((i * 7919) % many.size());
+        }
+        std::size_t comparisons = 0;
+        auto sorted = lz::sorted(many, CountingLess{ &comparisons });
+        std::vector<int> first;
+        for (auto it = sorted.begin(); first.size() < 10; ++it) {
+            first.push_back(*it);
+        }
+        CHECK(first == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+        CHECK(comparisons < 4 * many.size());
+
+        auto all = sorted.toVector();
+        CHECK(all.size() == many.size());
+        CHECK(std::is_sorted(all.begin(), all.end()));
+    }
+}
+
+TEST_CASE("Sorted to containers", "[Sorted][To container]") {
+    std::vector<int> vec = { 3, 1, 2 };
+    auto sorted = lz::sorted(vec);
+
+    SECTION("To array") {
+        CHECK(sorted.toArray<3>() == std::array<int, 3>{ 1, 2, 3 });
+    }
+
+    SECTION("To vector") {
+        CHECK(sorted.toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(sorted.to<std::list<int>>() == std::list<int>{ 1, 2, 3 });
+    }
+
+    SECTION("To map") {
+        std::map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(sorted.toMap([](const int i) { return i; }) == expected);
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> expected = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+        CHECK(sorted.toUnorderedMap([](const int i) { return i; }) == expected);
+    }
+}
@@ -0,0 +1,109 @@
+#include <Lz/Map.hpp>
+#include <Lz/Stats.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Stats in a single pass", "[Stats][Basic functionality]") {
+    std::vector<int> vec = { 2, 4, 4, 4, 5, 5, 7, 9 };
+
+    SECTION("Should calculate all metrics") {
+        auto stats = lz::stats(vec);
+        CHECK(stats.count() == 8);
+        CHECK(stats.sum() == 40);
+        CHECK(stats.mean() == Approx(5.));
+        CHECK(stats.variance() == Approx(4.));
+        CHECK(stats.stddev() == Approx(2.));
+        CHECK(stats.sampleVariance() == Approx(32. / 7.));
+        CHECK(stats.min() == 2);
+        CHECK(stats.max() == 9);
+    }
+
+    SECTION("Should not truncate the sum of small integers") {
+        std::vector<std::uint8_t> bytes(300, 1);
+        auto stats = lz::stats(bytes);
+        static_assert(std::is_same<decltype(stats.sum()), int>::value, "The sum should be promoted");
+        CHECK(stats.sum() == 300);
+        CHECK(stats.mean() == Approx(1.));
+        CHECK((stats + stats).sum() == 600);
+    }
+
+    SECTION("Should evaluate a lazy sequence once") {
+        std::size_t calls = 0;
+        auto map = lz::map(vec, [&calls](const int i) {
+            ++calls;
+            return static_cast<double>(i) / 2.;
+        });
+        auto stats = lz::stats(map);
+        CHECK(calls == vec.size());
+        CHECK(stats.mean() == Approx(2.5));
+        CHECK(stats.max() == Approx(4.5));
+    }
+
+    SECTION("Should work with input iterators") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto stats = lz::stats(list.begin(), list.end());
+        CHECK(stats.count() == 8);
+        CHECK(stats.variance() == Approx(4.));
+    }
+
+    SECTION("Should be empty") {
+        std::vector<int> empty;
+        auto stats = lz::stats(empty);
+        CHECK(stats.empty());
+        CHECK(stats.count() == 0);
+        CHECK(stats.mean() == 0.);
+        CHECK(stats.variance() == 0.);
+    }
+
+    SECTION("Should be stable for large offsets") {
+        std::vector<double> offsets = { 1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16 };
+        CHECK(lz::stats(offsets).sampleVariance() == Approx(30.));
+    }
+}
+
+TEST_CASE("Stats merging", "[Stats][Binary ops]") {
+    std::vector<int> vec = { 2, 4, 4, 4, 5, 5, 7, 9 };
+
+    SECTION("Merging partitions should equal the whole") {
+        auto left = lz::stats(vec.begin(), vec.begin() + 3);
+        auto right = lz::stats(vec.begin() + 3, vec.end());
+        auto merged = left + right;
+        CHECK(merged.count() == 8);
+        CHECK(merged.sum() == 40);
+        CHECK(merged.mean() == Approx(5.));
+        CHECK(merged.variance() == Approx(4.));
+        CHECK(merged.min() == 2);
+        CHECK(merged.max() == 9);
+    }
+
+    SECTION("Merging with empty") {
+        lz::Stats<int> empty;
+        auto stats = lz::stats(vec);
+        CHECK((empty + stats).variance() == Approx(4.));
+        CHECK(stats.merge(empty).variance() == Approx(4.));
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Parallel should equal sequential") {
+        std::vector<double> many(1000);
+        for (std::size_t i = 0; i < many.size(); ++i) {
+            many[i] = static_cast<double>(i % 17) * 0.5;
+        }
+        auto sequential = lz::stats(many);
+        auto parallel = lz::stats(many, std::execution::par);
+        CHECK(parallel.count() == sequential.count());
+        CHECK(parallel.mean() == Approx(sequential.mean()));
+        CHECK(parallel.variance() == Approx(sequential.variance()));
+        CHECK(parallel.max() == sequential.max());
+    }
+#endif
+
+    SECTION("Adding values") {
+        lz::Stats<int> stats;
+        for (const int i : vec) {
+            stats.add(i);
+        }
+        CHECK(stats.variance() == Approx(4.));
+        CHECK(stats.min() == 2);
+    }
+}
@@ -0,0 +1,103 @@
+#include "Lz/Tee.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Map.hpp>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace {
+struct Summer {
+    int sum = 0;
+
+    void operator()(const int i) {
+        sum += i;
+    }
+};
+} // namespace
+
+TEST_CASE("Tee basic functionality", "[Tee][Basic functionality]") {
+    std::vector<int> v(100);
+    std::iota(v.begin(), v.end(), 0);
+    int evaluated = 0;
+    std::function<int(int)> count = [&evaluated](const int i) {
+        ++evaluated;
+        return i;
+    };
+    auto mapped = lz::map(v, std::move(count));
+
+    SECTION("Should evaluate every element once") {
+        auto views = lz::tee(mapped, 3);
+        REQUIRE(views.size() == 3);
+        CHECK(views[0].toVector() == v);
+        CHECK(views[2].toVector() == v);
+        CHECK(views[1].toVector() == v);
+        CHECK(evaluated == 100);
+    }
+
+    SECTION("Should be iterable in lockstep") {
+        auto views = lz::tee(mapped, 2);
+        auto first = views[0].begin();
+        auto second = views[1].begin();
+        int pairs = 0;
+        for (; first != views[0].end() && second != views[1].end(); ++first, ++second) {
+            CHECK(*first == *second);
+            ++pairs;
+        }
+        CHECK(pairs == 100);
+        CHECK(evaluated == 100);
+    }
+
+    SECTION("Should only buffer elements that have not been passed by every view") {
+        std::vector<std::shared_ptr<int>> pointers = { std::make_shared<int>(1), std::make_shared<int>(2) };
+        auto views = lz::tee(pointers, 2);
+        for (const std::shared_ptr<int>& p : views[0]) {
+            static_cast<void>(p);
+        }
+        CHECK(pointers[0].use_count() == 2);
+        CHECK(pointers[1].use_count() == 2);
+
+        {
+            auto it = views[1].begin();
+            ++it;
+            CHECK(pointers[0].use_count() == 1);
+        }
+        views.pop_back();
+        CHECK(pointers[1].use_count() == 1);
+    }
+
+    SECTION("Should be empty for empty sequences") {
+        std::vector<int> empty;
+        auto views = lz::tee(empty, 2);
+        CHECK(views[0].begin() == views[0].end());
+        CHECK(views[1].begin() == views[1].end());
+    }
+}
+
+TEST_CASE("Fanout basic functionality", "[Tee][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+
+    SECTION("Should pass every element to every sink in one pass") {
+        int evaluated = 0;
+        std::function<int(int)> count = [&evaluated](const int i) {
+            ++evaluated;
+            return i;
+        };
+        std::vector<int> odds;
+        auto sinks = lz::fanout(lz::map(v, std::move(count)), Summer(), [&odds](const int i) {
+            if (i % 2 != 0) {
+                odds.push_back(i);
+            }
+        });
+        CHECK(std::get<0>(sinks).sum == 15);
+        CHECK(odds == std::vector<int>{ 1, 3, 5 });
+        CHECK(evaluated == 5);
+    }
+
+    SECTION("Should allow sinks of the same type") {
+        auto sinks = lz::fanout(v, Summer(), Summer());
+        CHECK(std::get<0>(sinks).sum == 15);
+        CHECK(std::get<1>(sinks).sum == 15);
+    }
+}
@@ -0,0 +1,107 @@
+#include "Lz/ThreadPool.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Parallel.hpp>
+#include <Lz/Range.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+// Runs all parts on the calling thread, in order
+struct SequentialExecutor {
+    std::size_t calls = 0;
+
+    template<class Function>
+    void run(const std::size_t parts, const Function& function) {
+        ++calls;
+        for (std::size_t part = 0; part < parts; ++part) {
+            function(part);
+        }
+    }
+};
+} // namespace
+
+TEST_CASE("Thread pool basic functionality", "[ThreadPool][Basic functionality]") {
+    lz::ThreadPool pool(3);
+
+    SECTION("Should have the requested amount of threads") {
+        CHECK(pool.size() == 3);
+        CHECK(lz::ThreadPool::global().size() >= 1);
+    }
+
+    SECTION("Should run every part once") {
+        std::vector<int> runs(100);
+        pool.run(runs.size(), [&runs](const std::size_t part) { ++runs[part]; });
+        CHECK(std::all_of(runs.begin(), runs.end(), [](const int i) { return i == 1; }));
+    }
+
+    SECTION("Should run submitted tasks") {
+        std::atomic<int> counter(0);
+        {
+            lz::ThreadPool local(2);
+            for (int i = 0; i < 50; ++i) {
+                local.submit([&counter] { ++counter; });
+            }
+        }
+        CHECK(counter == 50);
+    }
+
+    SECTION("Should rethrow exceptions after all parts have finished") {
+        std::atomic<int> finished(0);
+        CHECK_THROWS_AS(pool.run(8,
+                                 [&finished](const std::size_t part) {
+                                     if (part == 5) {
+                                         throw std::runtime_error("");
+                                     }
+                                     ++finished;
+                                 }),
+                        std::runtime_error);
+        CHECK(finished == 7);
+    }
+
+    SECTION("Should allow nested runs") {
+        std::atomic<int> counter(0);
+        pool.run(4, [&pool, &counter](std::size_t) { pool.run(4, [&counter](std::size_t) { ++counter; }); });
+        CHECK(counter == 16);
+    }
+
+    SECTION("Should wait until a task has finished") {
+        std::atomic<bool> done(false);
+        std::atomic<bool> started(false);
+        pool.submit([&done, &started] {
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            done = true;
+        });
+        pool.waitUntil([&done] { return done.load(); });
+        CHECK(started);
+        CHECK(done);
+    }
+}
+
+TEST_CASE("Thread pool as executor", "[ThreadPool][Basic functionality]") {
+    auto range = lz::range(0, 1000);
+
+    SECTION("Should be passed to the parallel functions") {
+        lz::ThreadPool pool(2);
+        CHECK(lz::parallelFoldl(range, 0, std::plus<int>(), 4, pool) == 499500);
+        CHECK(lz::parallelCountIf(range, [](const int i) { return i < 10; }, 4, pool) == 10);
+        CHECK(lz::parallelToVector(range, 4, pool).size() == 1000);
+    }
+
+    SECTION("Should be replaceable by custom executors") {
+        SequentialExecutor executor;
+        std::vector<int> visited;
+        lz::parallelForEach(range, [&visited](const int i) { visited.push_back(i); }, 4, executor);
+        CHECK(executor.calls == 1);
+        std::vector<int> expected(1000);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(visited == expected);
+    }
+}
@@ -0,0 +1,71 @@
+#include <Lz/Map.hpp>
+#include <Lz/TopK.hpp>
+#include <catch2/catch.hpp>
+#include <limits>
+#include <list>
+
+TEST_CASE("TopK with bounded memory", "[TopK][Basic functionality]") {
+    std::vector<int> vec = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+
+    SECTION("Should get the largest elements, largest first") {
+        CHECK(lz::topK(vec, 3) == std::vector<int>{ 9, 8, 7 });
+    }
+
+    SECTION("Should get the smallest elements, smallest first") {
+        CHECK(lz::bottomK(vec, 4) == std::vector<int>{ 0, 1, 2, 3 });
+    }
+
+    SECTION("Should use a custom comparer") {
+        CHECK(lz::topK(vec, 2, std::greater<int>()) == std::vector<int>{ 0, 1 });
+    }
+
+    SECTION("Should return everything if k is larger than the sequence") {
+        CHECK(lz::topK(vec, 20).size() == vec.size());
+        CHECK(lz::topK(vec, 0).empty());
+        CHECK(lz::topK(std::vector<int>(), 3).empty());
+    }
+
+    SECTION("Should not allocate k elements up front") {
+        const std::size_t everything = (std::numeric_limits<std::size_t>::max)();
+        CHECK(lz::topK(vec, everything) == std::vector<int>{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 });
+        std::list<int> list(vec.begin(), vec.end());
+        CHECK(lz::bottomK(list, everything).size() == vec.size());
+#ifdef LZ_HAS_EXECUTION
+        CHECK(lz::topK(vec, everything, std::less<>(), std::execution::par).size() == vec.size());
+#endif
+    }
+
+    SECTION("Should work with lazy input sequences") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto map = lz::map(list, [](const int i) { return i * 10; });
+        CHECK(lz::topK(map, 2) == std::vector<int>{ 90, 80 });
+    }
+}
+
+TEST_CASE("TopKBy evaluating keys once", "[TopK][Binary ops]") {
+    std::vector<std::string> words = { "a", "abcd", "ab", "abcdef", "abc" };
+
+    SECTION("Should select by key") {
+        std::size_t calls = 0;
+        auto longest = lz::topKBy(words, 2, [&calls](const std::string& s) {
+            ++calls;
+            return s.size();
+        });
+        CHECK(longest == std::vector<std::string>{ "abcdef", "abcd" });
+        CHECK(calls == words.size());
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Parallel should equal sequential") {
+        std::vector<int> many(10000);
+        for (std::size_t i = 0; i < many.size(); ++i) {
+            many[i] = static_cast<int>((i * 7919) % many.size());
+        }
+        CHECK(lz::topK(many, 5, std::less<>(), std::execution::par) == std::vector<int>{ 9999, 9998, 9997, 9996, 9995 });
+        CHECK(lz::bottomK(many, 3, std::less<>(), std::execution::par) == std::vector<int>{ 0, 1, 2 });
+        auto negated = lz::topKBy(
+            many, 2, [](const int i) { return -i; }, std::less<>(), std::execution::par);
+        CHECK(negated == std::vector<int>{ 0, 1 });
+    }
+#endif
+}
@@ -0,0 +1,122 @@
+#include "Lz/Window.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Map.hpp>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
+
+TEST_CASE("Window basic functionality", "[Window][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+    auto windows = lz::window(v, 3);
+
+    SECTION("Should yield every window") {
+        std::vector<std::vector<int>> actual;
+        for (auto w : windows) {
+            actual.push_back(w.toVector());
+        }
+        CHECK(actual == std::vector<std::vector<int>>{ { 1, 2, 3 }, { 2, 3, 4 }, { 3, 4, 5 } });
+    }
+
+    SECTION("Windows should stay valid after incrementing") {
+        auto it = windows.begin();
+        auto first = *it++;
+        CHECK(first.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(it->toVector() == std::vector<int>{ 2, 3, 4 });
+        auto all = windows.toVector();
+        REQUIRE(all.size() == 3);
+        CHECK(all[0].toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(all[2].toVector() == std::vector<int>{ 3, 4, 5 });
+    }
+
+    SECTION("Should reuse the ring buffer if the window is not kept") {
+        auto it = windows.begin();
+        ++it;
+        const int* ring = std::addressof(*std::min_element(it->begin(), it->end()));
+        ++it;
+        CHECK(std::addressof(*std::min_element(it->begin(), it->end())) != ring);
+        CHECK(std::addressof(*std::max_element(it->begin(), it->end())) == ring);
+    }
+
+    SECTION("Should be correct length") {
+        CHECK(std::distance(windows.begin(), windows.end()) == 3);
+        CHECK(lz::window(v, 5).distance() == 1);
+        CHECK(lz::window(v, 1).distance() == 5);
+    }
+
+    SECTION("Should be empty if the sequence is too short") {
+        CHECK(lz::window(v, 6).begin() == lz::window(v, 6).end());
+        std::vector<int> empty;
+        CHECK(lz::window(empty, 2).begin() == lz::window(empty, 2).end());
+    }
+
+    SECTION("Should dereference every element once") {
+        int calls = 0;
+        std::function<int(int)> count = [&calls](const int i) {
+            ++calls;
+            return i * 10;
+        };
+        auto mapped = lz::map(v, std::move(count));
+        std::vector<int> sums;
+        for (auto w : lz::window(mapped, 2)) {
+            sums.push_back(*w.begin() + *std::next(w.begin()));
+        }
+        CHECK(sums == std::vector<int>{ 30, 50, 70, 90 });
+        CHECK(calls == 5);
+    }
+
+    SECTION("Should work with input iterators") {
+        std::istringstream stream("1 2 3 4");
+        auto begin = std::istream_iterator<int>(stream);
+        auto end = std::istream_iterator<int>();
+        std::vector<int> firsts;
+        for (auto w : lz::windowRange(begin, end, 2)) {
+            firsts.push_back(*w.begin());
+        }
+        CHECK(firsts == std::vector<int>{ 1, 2, 3 });
+    }
+}
+
+TEST_CASE("Window binary operations", "[Window][Binary ops]") {
+    std::list<int> lst = { 1, 2, 3, 4 };
+    auto windows = lz::window(lst, 2);
+    auto it = windows.begin();
+
+    SECTION("Operator++") {
+        CHECK(it->toVector() == std::vector<int>{ 1, 2 });
+        ++it;
+        CHECK(it->toVector() == std::vector<int>{ 2, 3 });
+        ++it;
+        CHECK(it->toVector() == std::vector<int>{ 3, 4 });
+        ++it;
+        CHECK(it == windows.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it != windows.end());
+        auto copy = it;
+        CHECK(copy == it);
+        ++copy;
+        CHECK(copy != it);
+    }
+}
+
+TEST_CASE("Window to containers", "[Window][To container]") {
+    std::vector<int> v = { 1, 2, 3 };
+    auto firsts = lz::map(lz::window(v, 2), [](const lz::Window<std::vector<int>::iterator>::value_type& w) { return *w.begin(); });
+
+    SECTION("To array") {
+        CHECK(firsts.toArray<2>() == std::array<int, 2>{ 1, 2 });
+    }
+
+    SECTION("To vector") {
+        CHECK(firsts.toVector() == std::vector<int>{ 1, 2 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(firsts.to<std::list<int>>() == std::list<int>{ 1, 2 });
+    }
+}
@@ -12,6 +12,9 @@ add_rules("mode.debug", "mode.release")
 target("cpp-lazy")
     add_includedirs("include", { public = true })
     add_packages("fmt", { public = true })
+    if is_plat("linux", "bsd") then
+        add_syslinks("pthread", { public = true })
+    end
     if has_config("cpp-lazy-use-modules") then
         add_files("src/lz.cpp")
         set_languages("c++20")